@@ -0,0 +1,69 @@
+#include "result/catching.h"
+
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+
+namespace result::bench {
+
+[[gnu::noinline]] int legacyParse(int x) {
+    if (x < 0) [[unlikely]] {
+        throw std::invalid_argument("negative");
+    }
+    return x * 2;
+}
+
+[[gnu::noinline]] int plain(int x) {
+    return legacyParse(x);
+}
+
+[[gnu::noinline]] Result<int, std::invalid_argument> wrapped(int x) {
+    return catching<std::invalid_argument>(legacyParse)(x);
+}
+
+[[gnu::noinline]] int roundTrip(int x) {
+    return wrapped(x).valueOrThrow();
+}
+
+// The three should be on par: nothing throws, so nothing but unwind tables is added
+void callPlain(benchmark::State& state) {
+    int input = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        benchmark::DoNotOptimize(plain(input));
+    }
+}
+
+void callCatching(benchmark::State& state) {
+    int input = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        auto r = wrapped(input);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+void callValueOrThrow(benchmark::State& state) {
+    int input = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        benchmark::DoNotOptimize(roundTrip(input));
+    }
+}
+
+// For scale: what the boundary costs when it is crossed by an exception
+void callCatchingThrown(benchmark::State& state) {
+    int input = -1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        auto r = wrapped(input);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+BENCHMARK(callPlain);
+BENCHMARK(callCatching);
+BENCHMARK(callValueOrThrow);
+BENCHMARK(callCatchingThrown);
+
+}  // namespace result::bench
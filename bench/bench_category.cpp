@@ -0,0 +1,101 @@
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace result::bench {
+
+template <int I>
+struct RpcError {};
+
+using Retryable = ErrorCategory<RpcError<1>, RpcError<3>, RpcError<5>, RpcError<7>>;
+
+using Reply = Result<int,
+                     RpcError<0>,
+                     RpcError<1>,
+                     RpcError<2>,
+                     RpcError<3>,
+                     RpcError<4>,
+                     RpcError<5>,
+                     RpcError<6>,
+                     RpcError<7>>;
+
+template <int I>
+Reply makeReply(int) {
+    return makeError(RpcError<I>{});
+}
+
+template <>
+Reply makeReply<-1>(int x) {
+    return x;
+}
+
+std::vector<Reply> replies() {
+    using Make = Reply (*)(int);
+    constexpr Make Makers[] = {
+        makeReply<-1>,
+        makeReply<0>,
+        makeReply<1>,
+        makeReply<2>,
+        makeReply<3>,
+        makeReply<4>,
+        makeReply<5>,
+        makeReply<6>,
+        makeReply<7>,
+    };
+
+    std::vector<Reply> out;
+    uint64_t state = 42;
+    for (int i = 0; i < 4096; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        out.push_back(Makers[(state >> 33) % std::size(Makers)](i));
+    }
+    return out;
+}
+
+void BM_RetryableHasErrorChain(benchmark::State& state) {
+    const auto rs = replies();
+    for (auto _ : state) {
+        int64_t retryable = 0;
+        for (const Reply& r : rs) {
+            retryable += r.hasError<RpcError<1>>() || r.hasError<RpcError<3>>() ||
+                         r.hasError<RpcError<5>>() || r.hasError<RpcError<7>>();
+        }
+        benchmark::DoNotOptimize(retryable);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+void BM_RetryableHasErrorIn(benchmark::State& state) {
+    const auto rs = replies();
+    for (auto _ : state) {
+        int64_t retryable = 0;
+        for (const Reply& r : rs) {
+            retryable += r.hasErrorIn<Retryable>();
+        }
+        benchmark::DoNotOptimize(retryable);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+void BM_RetryableVisit(benchmark::State& state) {
+    const auto rs = replies();
+    for (auto _ : state) {
+        int64_t retryable = 0;
+        for (const Reply& r : rs) {
+            retryable += r.visit([]<typename T>(const T&) {
+                return tl::Contains<Retryable, T>;
+            });
+        }
+        benchmark::DoNotOptimize(retryable);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+BENCHMARK(BM_RetryableHasErrorChain);
+BENCHMARK(BM_RetryableHasErrorIn);
+BENCHMARK(BM_RetryableVisit);
+
+}  // namespace result::bench
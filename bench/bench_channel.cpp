@@ -0,0 +1,71 @@
+#include "result/channel.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace result::bench {
+
+struct StageFailed {
+    int stage = 0;
+};
+
+using Item = Result<int64_t, StageFailed>;
+
+constexpr int64_t ItemsPerIteration = 1 << 18;
+
+// state.range(0) producers, state.range(1) consumers, batches of state.range(2)
+void channelThroughput(benchmark::State& state) {
+    const auto producers = static_cast<int>(state.range(0));
+    const auto consumers = static_cast<int>(state.range(1));
+    const auto batch_size = static_cast<size_t>(state.range(2));
+
+    for (auto _ : state) {
+        Channel<Item> channel(1024);
+        std::vector<std::thread> threads;
+
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                std::vector<Item> batch(batch_size);
+                int64_t sum = 0;
+                while (size_t n = channel.recvBatch(batch)) {
+                    for (size_t i = 0; i < n; ++i) {
+                        sum += batch[i].valueOr(0);
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+
+        std::vector<std::thread> senders;
+        for (int p = 0; p < producers; ++p) {
+            senders.emplace_back([&] {
+                std::vector<Item> batch;
+                for (int64_t i = 0; i < ItemsPerIteration / producers; i += batch.size()) {
+                    batch.assign(batch_size, Item(i));
+                    channel.sendBatch(batch);
+                }
+            });
+        }
+
+        for (auto& t : senders) {
+            t.join();
+        }
+        channel.close();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ItemsPerIteration);
+}
+
+BENCHMARK(channelThroughput)
+    ->ArgNames({"producers", "consumers", "batch"})
+    ->ArgsProduct({{1, 2, 4}, {1, 2, 4}, {1, 32}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace result::bench
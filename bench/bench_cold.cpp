@@ -0,0 +1,74 @@
+#include "result/combine/and_then.h"
+#include "result/combine/map.h"
+#include "result/combine/map_err.h"
+#include "result/detail/overloaded.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace result::bench {
+
+// Errors heavy enough that constructing and converting them is real code
+struct ParseError {
+    std::string input;
+    int position = 0;
+};
+
+struct RangeError {
+    std::string field;
+    long long value = 0;
+};
+
+struct RequestError {
+    std::string reason;
+};
+
+using Parsed = Result<long long, ParseError>;
+
+[[gnu::noinline]] Parsed parse(int x) {
+    if (x < 0) {
+        return makeError(ParseError{"negative", x});
+    }
+    return x;
+}
+
+Result<long long, RangeError> checkRange(long long x) {
+    if (x > 1'000'000) {
+        return makeError(RangeError{"x", x});
+    }
+    return x;
+}
+
+// The hot function: compare its size in result_bench and result_bench_inlined_errors with
+// `nm -S --size-sort`, along with the latencies below
+[[gnu::noinline]] Result<long long, RequestError, RangeError> handle(int x) {
+    auto describe = detail::Overloaded{
+        [](ParseError e) { return RequestError{"cannot parse " + e.input}; },
+        [](RangeError e) { return e; },
+    };
+    return parse(x) | andThen(checkRange) | map([](long long v) { return v * 3 + 1; }) |
+           mapErr(describe);
+}
+
+void run(benchmark::State& state, int input) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        auto r = handle(input);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+void coldValue(benchmark::State& state) {
+    run(state, 1);
+}
+
+void coldError(benchmark::State& state) {
+    run(state, -1);
+}
+
+BENCHMARK(coldValue);
+BENCHMARK(coldError);
+
+}  // namespace result::bench
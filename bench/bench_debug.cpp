@@ -0,0 +1,79 @@
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Built at -O0 into result_bench_debug: tracks the cost of the accessors in debug builds
+
+namespace result::bench {
+
+struct DebugError {
+    int code = 0;
+};
+
+using Checked = Result<int64_t, DebugError, std::string>;
+
+std::vector<Checked> results() {
+    std::vector<Checked> out;
+    for (int64_t i = 0; i < 1024; ++i) {
+        if (i % 16 == 0) {
+            out.emplace_back(makeError(DebugError{static_cast<int>(i)}));
+        } else {
+            out.emplace_back(i);
+        }
+    }
+    return out;
+}
+
+void BM_DebugValue(benchmark::State& state) {
+    const auto rs = results();
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const Checked& r : rs) {
+            if (r.hasValue()) {
+                sum += r.value();
+            } else if (r.hasError<DebugError>()) {
+                sum -= r.error<DebugError>().code;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+void BM_DebugVisit(benchmark::State& state) {
+    const auto rs = results();
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const Checked& r : rs) {
+            sum += r.visit([]<typename T>(const T& x) -> int64_t {
+                if constexpr (std::is_same_v<T, int64_t>) {
+                    return x;
+                } else {
+                    return 0;
+                }
+            });
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+void BM_DebugCopy(benchmark::State& state) {
+    const auto rs = results();
+    for (auto _ : state) {
+        std::vector<Checked> copy = rs;
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rs.size()));
+}
+
+BENCHMARK(BM_DebugValue);
+BENCHMARK(BM_DebugVisit);
+BENCHMARK(BM_DebugCopy);
+
+}  // namespace result::bench
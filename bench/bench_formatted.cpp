@@ -0,0 +1,61 @@
+#include "result/error/formatted.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <format>
+#include <string>
+
+namespace result::bench {
+
+struct EagerError {
+    std::string message;
+};
+
+using Eager = Result<int, EagerError>;
+using Deferred = Result<int, FormattedError<uint64_t, uint64_t>>;
+
+[[gnu::noinline]] Eager readEager(uint64_t block, uint64_t offset) {
+    return makeError(EagerError{std::format("no block {} at offset {}", block, offset)});
+}
+
+[[gnu::noinline]] Deferred readDeferred(uint64_t block, uint64_t offset) {
+    return makeError(FormattedError("no block {} at offset {}", block, offset));
+}
+
+// The caller handles the error and drops it, the common case on a retry or fallback path
+template <typename R, R (*F)(uint64_t, uint64_t)>
+void dropped(benchmark::State& state) {
+    uint64_t block = 12345;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(block);
+        auto r = F(block, block * 4096);
+        benchmark::DoNotOptimize(r.valueOr(0));
+    }
+}
+
+void eagerDropped(benchmark::State& state) {
+    dropped<Eager, readEager>(state);
+}
+
+void deferredDropped(benchmark::State& state) {
+    dropped<Deferred, readDeferred>(state);
+}
+
+// The message is observed: the deferred error pays the same formatting, only later
+void deferredObserved(benchmark::State& state) {
+    uint64_t block = 12345;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(block);
+        auto r = readDeferred(block, block * 4096);
+        auto message = r.error<FormattedError<uint64_t, uint64_t>>().message();
+        benchmark::DoNotOptimize(message);
+    }
+}
+
+BENCHMARK(eagerDropped);
+BENCHMARK(deferredDropped);
+BENCHMARK(deferredObserved);
+
+}  // namespace result::bench
@@ -0,0 +1,108 @@
+#include "result/future.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <future>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+namespace result::bench {
+
+struct HandoffError {};
+
+using Handoff = Result<int, HandoffError>;
+
+// Create, fulfill and consume on one thread: the cost of the shared state itself
+void stdFutureLocal(benchmark::State& state) {
+    for (auto _ : state) {
+        std::promise<Handoff> promise;
+        auto future = promise.get_future();
+        promise.set_value(1);
+        benchmark::DoNotOptimize(future.get());
+    }
+}
+
+void resultFutureLocal(benchmark::State& state) {
+    for (auto _ : state) {
+        Promise<Handoff> promise;
+        auto future = promise.getFuture();
+        promise.setResult(1);
+        benchmark::DoNotOptimize(std::move(future).get());
+    }
+}
+
+void resultFuturePooled(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<> alloc(&pool);
+
+    for (auto _ : state) {
+        Promise<Handoff> promise(std::allocator_arg, alloc);
+        auto future = promise.getFuture();
+        promise.setResult(1);
+        benchmark::DoNotOptimize(std::move(future).get());
+    }
+}
+
+void resultFutureThen(benchmark::State& state) {
+    int sum = 0;
+    for (auto _ : state) {
+        Promise<Handoff> promise;
+        promise.getFuture().then([&sum](Promise<Handoff>::Output r) { sum += *r; });
+        promise.setResult(1);
+    }
+    benchmark::DoNotOptimize(sum);
+}
+
+// A producer thread fulfills promises in order while the caller consumes the futures
+template <typename P, typename F, typename Set, typename Get>
+void crossThread(benchmark::State& state, Set set, Get get) {
+    constexpr int Rounds = 1 << 12;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<P> promises(Rounds);
+        std::vector<F> futures;
+        futures.reserve(Rounds);
+        for (P& promise : promises) {
+            futures.push_back(get(promise));
+        }
+        state.ResumeTiming();
+
+        std::jthread producer([&] {
+            for (int i = 0; i < Rounds; ++i) {
+                set(promises[i], i);
+            }
+        });
+        for (F& future : futures) {
+            benchmark::DoNotOptimize(std::move(future).get());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * Rounds);
+}
+
+void stdFutureCrossThread(benchmark::State& state) {
+    crossThread<std::promise<Handoff>, std::future<Handoff>>(
+        state,
+        [](std::promise<Handoff>& p, int i) { p.set_value(i); },
+        [](std::promise<Handoff>& p) { return p.get_future(); });
+}
+
+void resultFutureCrossThread(benchmark::State& state) {
+    crossThread<Promise<Handoff>, Future<Handoff>>(
+        state,
+        [](Promise<Handoff>& p, int i) { p.setResult(i); },
+        [](Promise<Handoff>& p) { return p.getFuture(); });
+}
+
+BENCHMARK(stdFutureLocal);
+BENCHMARK(resultFutureLocal);
+BENCHMARK(resultFuturePooled);
+BENCHMARK(resultFutureThen);
+BENCHMARK(stdFutureCrossThread)->UseRealTime();
+BENCHMARK(resultFutureCrossThread)->UseRealTime();
+
+}  // namespace result::bench
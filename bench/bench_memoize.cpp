@@ -0,0 +1,56 @@
+#include "result/memoize.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace result::bench {
+
+struct NotFound {};
+struct Transient {};
+
+using Cached = Result<uint64_t, NotFound, Transient>;
+
+// Stands in for an expensive lookup: a few hundred nanoseconds of hashing
+[[gnu::noinline]] Cached slowLookup(uint64_t key) {
+    if (key % 7 == 0) {
+        return makeError(NotFound{});
+    }
+    uint64_t h = key;
+    for (int i = 0; i < 256; ++i) {
+        h = h * 0x9e3779b97f4a7c15ULL + 1;
+    }
+    return h;
+}
+
+// Threads share one cache, keys are drawn from a working set twice its capacity
+void memoizeContended(benchmark::State& state) {
+    static auto lookup = memoize(&slowLookup, MemoizePolicy<NotFound>{.capacity = 1 << 14});
+    uint64_t key = static_cast<uint64_t>(state.thread_index()) * 7919;
+
+    for (auto _ : state) {
+        key = (key * 6364136223846793005ULL + 1442695040888963407ULL);
+        benchmark::DoNotOptimize(lookup(key % (1 << 15)));
+    }
+
+    if (state.thread_index() == 0) {
+        state.counters["hit_rate"] = lookup.stats().hitRate();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void memoizeBaseline(benchmark::State& state) {
+    uint64_t key = static_cast<uint64_t>(state.thread_index()) * 7919;
+
+    for (auto _ : state) {
+        key = (key * 6364136223846793005ULL + 1442695040888963407ULL);
+        benchmark::DoNotOptimize(slowLookup(key % (1 << 15)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(memoizeContended)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(memoizeBaseline)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace result::bench
@@ -0,0 +1,84 @@
+#include "result/metrics/histogram.h"
+#include "result/task.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stop_token>
+#include <thread>
+
+namespace result::bench {
+
+using namespace std::chrono_literals;
+
+struct ReplicaTimeout {};
+
+using Read = Result<int, ReplicaTimeout>;
+
+// Simulated replica: 200us usually, 5ms for one read in 20, cut short by a stop request
+Read readReplica(uint64_t seed, std::stop_token token) {
+    const uint64_t mixed = (seed * 0x9e3779b97f4a7c15ULL) >> 32;
+    const auto latency = mixed % 20 == 0 ? 5ms : 200us;
+
+    const auto deadline = std::chrono::steady_clock::now() + latency;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (token.stop_requested()) {
+            return makeError(ReplicaTimeout{});
+        }
+        std::this_thread::sleep_for(20us);
+    }
+    return static_cast<int>(seed);
+}
+
+template <typename Call>
+void runReads(benchmark::State& state, Call call) {
+    LatencyHistogram latencies;
+    uint64_t seed = 0;
+
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        auto r = call(++seed);
+        latencies.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count()));
+        benchmark::DoNotOptimize(r);
+    }
+
+    auto snapshot = latencies.snapshot();
+    state.counters["p50_us"] = static_cast<double>(snapshot.percentile(0.5)) / 1e3;
+    state.counters["p99_us"] = static_cast<double>(snapshot.percentile(0.99)) / 1e3;
+}
+
+void BM_ReplicaSingle(benchmark::State& state) {
+    runReads(state, [](uint64_t seed) { return readReplica(seed, {}); });
+}
+
+void BM_ReplicaFirstOk(benchmark::State& state) {
+    ThreadPool pool(4);
+    runReads(state, [&](uint64_t seed) {
+        return firstOk(
+            pool,
+            [seed](std::stop_token t) { return readReplica(seed, t); },
+            [seed](std::stop_token t) { return readReplica(seed + 1, t); });
+    });
+}
+
+void BM_ReplicaHedge(benchmark::State& state) {
+    ThreadPool pool(4);
+    runReads(state, [&](uint64_t seed) {
+        return hedge(
+            pool,
+            [seed](std::stop_token t) { return readReplica(seed, t); },
+            [seed](std::stop_token t) { return readReplica(seed + 1, t); },
+            std::chrono::microseconds(state.range(0)));
+    });
+}
+
+BENCHMARK(BM_ReplicaSingle)->UseRealTime();
+BENCHMARK(BM_ReplicaFirstOk)->UseRealTime();
+BENCHMARK(BM_ReplicaHedge)->Arg(500)->Arg(1000)->UseRealTime();
+
+}  // namespace result::bench
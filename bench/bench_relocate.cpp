@@ -0,0 +1,84 @@
+#include "result/relocate.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace result::bench {
+
+struct RelocError {
+    int code = 0;
+};
+
+using Relocatable = Result<std::string, RelocError>;
+
+// The same Result behind a user-provided move, which hides its relocatability
+struct Opaque {
+    explicit Opaque(std::string s) : r(std::move(s)) {}
+    Opaque(Opaque&& other) noexcept : r(std::move(other.r)) {}
+
+    Relocatable r;
+};
+
+static_assert(!isTriviallyRelocatable<Opaque>);
+
+constexpr int64_t Elements = 10'000'000;
+
+template <typename T>
+void vectorGrow(benchmark::State& state) {
+    for (auto _ : state) {
+        std::vector<T> v;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            v.emplace_back(std::string("short"));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Doubling buffer as in ring buffers: relocation helpers against element-wise moves
+template <bool UseRelocate>
+void bufferGrow(benchmark::State& state) {
+    using T = Relocatable;
+    std::allocator<T> alloc;
+
+    for (auto _ : state) {
+        size_t capacity = 16;
+        size_t size = 0;
+        T* data = alloc.allocate(capacity);
+
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            if (size == capacity) {
+                T* grown = alloc.allocate(2 * capacity);
+                if constexpr (UseRelocate) {
+                    uninitializedRelocate(data, data + size, grown);
+                } else {
+                    for (size_t j = 0; j < size; ++j) {
+                        std::construct_at(grown + j, std::move(data[j]));
+                        std::destroy_at(data + j);
+                    }
+                }
+                alloc.deallocate(data, capacity);
+                data = grown;
+                capacity *= 2;
+            }
+            std::construct_at(data + size++, std::string("short"));
+        }
+
+        benchmark::DoNotOptimize(data);
+        std::destroy_n(data, size);
+        alloc.deallocate(data, capacity);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(vectorGrow<Relocatable>)->Arg(Elements)->Unit(benchmark::kMillisecond);
+BENCHMARK(vectorGrow<Opaque>)->Arg(Elements)->Unit(benchmark::kMillisecond);
+BENCHMARK(bufferGrow<true>)->Arg(Elements)->Unit(benchmark::kMillisecond);
+BENCHMARK(bufferGrow<false>)->Arg(Elements)->Unit(benchmark::kMillisecond);
+
+}  // namespace result::bench
@@ -0,0 +1,49 @@
+#include "result/result.h"
+#include "result/sampling.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace result::bench {
+
+struct SampledIoError {
+    int code = 0;
+};
+
+[[gnu::noinline]] Result<int, SampledIoError> readValue(int x) {
+    if (x % 8 == 0) {
+        return makeError(SampledIoError{x});
+    }
+    return x;
+}
+
+// Drains on the benchmark thread to keep the ring from filling up
+void runReads(benchmark::State& state) {
+    int x = 0;
+    int64_t reads = 0;
+    for (auto _ : state) {
+        auto r = readValue(++x);
+        benchmark::DoNotOptimize(r);
+        if (++reads % 4096 == 0) {
+            ErrorSampler::global().drain([](const ErrorSample& s) { benchmark::DoNotOptimize(s); });
+        }
+    }
+    state.SetItemsProcessed(reads);
+}
+
+void BM_SamplingDisabled(benchmark::State& state) {
+    ErrorSampler::global().disable();
+    runReads(state);
+}
+
+void BM_SamplingEnabled(benchmark::State& state) {
+    ErrorSampler::global().enable(static_cast<uint32_t>(state.range(0)));
+    runReads(state);
+    ErrorSampler::global().disable();
+}
+
+BENCHMARK(BM_SamplingDisabled);
+BENCHMARK(BM_SamplingEnabled)->Arg(1)->Arg(100)->Arg(10000);
+
+}  // namespace result::bench
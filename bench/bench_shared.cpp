@@ -0,0 +1,50 @@
+#include "result/error/shared.h"
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace result::bench {
+
+// An upstream failure with a payload worth sharing
+struct FetchError {
+    std::string url;
+    std::string body;
+    int status = 0;
+};
+
+FetchError failure() {
+    return FetchError{"https://upstream.example/some/long/path", std::string(512, 'x'), 503};
+}
+
+// One failure handed to state.range(0) waiters
+template <typename R>
+void fanOut(benchmark::State& state, R failed) {
+    std::vector<R> waiters;
+    waiters.reserve(state.range(0));
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            waiters.push_back(failed);
+        }
+        benchmark::DoNotOptimize(waiters.data());
+        waiters.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fanOutCopied(benchmark::State& state) {
+    fanOut(state, Result<int, FetchError>(makeError(failure())));
+}
+
+void fanOutShared(benchmark::State& state) {
+    fanOut(state, Result<int, Shared<FetchError>>(makeError(Shared(failure()))));
+}
+
+BENCHMARK(fanOutCopied)->Arg(16)->Arg(1024);
+BENCHMARK(fanOutShared)->Arg(16)->Arg(1024);
+
+}  // namespace result::bench
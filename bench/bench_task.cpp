@@ -0,0 +1,82 @@
+#include "result/task.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace result::bench {
+
+struct Error {};
+
+using Res = Result<int, Error>;
+
+Task<Res> leaf(int x) {
+    co_return x;
+}
+
+Task<Res> chain(ThreadPool& pool, int x) {
+    co_await schedule(pool);
+    int a = co_await leaf(x);
+    int b = co_await leaf(a + 1);
+    co_return a + b;
+}
+
+detail::Detached drive(Task<Res> task, std::atomic<int64_t>& remaining) {
+    benchmark::DoNotOptimize(co_await std::move(task).result());
+
+    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        remaining.notify_one();
+    }
+}
+
+void taskThroughput(benchmark::State& state) {
+    const auto threads = static_cast<size_t>(state.range(0));
+    constexpr int64_t Batch = 1 << 12;
+
+    // Outlives the pool, whose destructor joins the workers
+    std::atomic<int64_t> remaining{0};
+    ThreadPool pool(threads);
+
+    for (auto _ : state) {
+        remaining.store(Batch, std::memory_order_relaxed);
+
+        for (int64_t i = 0; i < Batch; ++i) {
+            drive(chain(pool, static_cast<int>(i)), remaining);
+        }
+
+        for (int64_t left; (left = remaining.load(std::memory_order_acquire)) != 0;) {
+            remaining.wait(left, std::memory_order_acquire);
+        }
+    }
+
+    const auto tasks = static_cast<double>(state.iterations() * Batch);
+    state.SetItemsProcessed(state.iterations() * Batch);
+    state.counters["per_core"] =
+        benchmark::Counter(tasks / static_cast<double>(threads), benchmark::Counter::kIsRate);
+}
+
+void syncChain(benchmark::State& state) {
+    for (auto _ : state) {
+        auto r = syncWait([] -> Task<Res> {
+            int sum = 0;
+            for (int i = 0; i < 1024; ++i) {
+                sum += co_await leaf(i);
+            }
+            co_return sum;
+        }());
+        benchmark::DoNotOptimize(r);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+BENCHMARK(taskThroughput)
+    ->RangeMultiplier(2)
+    ->Range(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime();
+
+BENCHMARK(syncChain);
+
+}  // namespace result::bench
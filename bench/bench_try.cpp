@@ -0,0 +1,70 @@
+#include "result/coro.h"
+#include "result/try.h"
+
+#include <benchmark/benchmark.h>
+
+namespace result::bench {
+
+struct ParseError {
+    int code = 0;
+};
+
+struct IoError {
+    int code = 0;
+};
+
+using Leaf = Result<int, ParseError>;
+using Outer = Result<int, ParseError, IoError>;
+
+[[gnu::noinline]] Leaf leaf(int x) {
+    if (x < 0) [[unlikely]] {
+        return makeError(ParseError{x});
+    }
+    return x;
+}
+
+[[gnu::noinline]] Outer viaTry(int x) {
+    int a = RESULT_TRY(leaf(x));
+    int b = RESULT_TRY(leaf(a + 1));
+    int c = RESULT_TRY(leaf(b + 1));
+    return a + b + c;
+}
+
+[[gnu::noinline]] Outer viaCoro(int x) {
+    int a = co_await leaf(x);
+    int b = co_await leaf(a + 1);
+    int c = co_await leaf(b + 1);
+    co_return a + b + c;
+}
+
+template <Outer (*F)(int)>
+void run(benchmark::State& state, int input) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        auto r = F(input);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+void tryValue(benchmark::State& state) {
+    run<viaTry>(state, 1);
+}
+
+void tryError(benchmark::State& state) {
+    run<viaTry>(state, -1);
+}
+
+void coroValue(benchmark::State& state) {
+    run<viaCoro>(state, 1);
+}
+
+void coroError(benchmark::State& state) {
+    run<viaCoro>(state, -1);
+}
+
+BENCHMARK(tryValue);
+BENCHMARK(coroValue);
+BENCHMARK(tryError);
+BENCHMARK(coroError);
+
+}  // namespace result::bench
@@ -0,0 +1,95 @@
+#include "result/result.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace result::bench {
+
+// Each layer of the call stack adds its own error type, as Union and andThen do,
+// and widens the Result of the layer below by conversion. RESULT_TRY would not: its
+// ErrorPropagator visits the error and constructs it in the wider Result via err_tag.
+template <int Layer>
+struct LayerError {
+    int code = 0;
+};
+
+template <int Layer>
+struct FatLayerError {
+    std::string what;
+};
+
+template <template <int> typename E>
+using Widened0 = Result<int, E<0>>;
+template <template <int> typename E>
+using Widened1 = Result<int, E<1>, E<0>>;
+template <template <int> typename E>
+using Widened2 = Result<int, E<2>, E<1>, E<0>>;
+template <template <int> typename E>
+using Widened3 = Result<int, E<3>, E<2>, E<1>, E<0>>;
+template <template <int> typename E>
+using Widened4 = Result<int, E<4>, E<3>, E<2>, E<1>, E<0>>;
+
+template <template <int> typename E>
+[[gnu::noinline]] Widened0<E> layer0(int x) {
+    if (x % 4 == 0) {
+        return makeError(E<0>{});
+    }
+    return x;
+}
+
+template <template <int> typename E>
+[[gnu::noinline]] Widened1<E> layer1(int x) {
+    Widened1<E> wide = layer0<E>(x);
+    return wide;
+}
+
+template <template <int> typename E>
+[[gnu::noinline]] Widened2<E> layer2(int x) {
+    Widened2<E> wide = layer1<E>(x);
+    return wide;
+}
+
+template <template <int> typename E>
+[[gnu::noinline]] Widened3<E> layer3(int x) {
+    Widened3<E> wide = layer2<E>(x);
+    return wide;
+}
+
+template <template <int> typename E>
+[[gnu::noinline]] Widened4<E> layer4(int x) {
+    Widened4<E> wide = layer3<E>(x);
+    return wide;
+}
+
+// Each layer converts the Result of the one below: trivially copyable errors are widened
+// with a memcpy and an index lookup, the others dispatch on the alternative
+template <template <int> typename E>
+void widenErrors(benchmark::State& state) {
+    int x = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(layer4<E>(x++));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Direct conversion of a narrow Result into a wide one
+template <template <int> typename E>
+void widenAssign(benchmark::State& state) {
+    Widened4<E> wide = 0;
+    Widened1<E> narrow = makeError(E<1>{});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(narrow);
+        wide = narrow;
+        benchmark::DoNotOptimize(wide);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(widenErrors<LayerError>);
+BENCHMARK(widenErrors<FatLayerError>);
+BENCHMARK(widenAssign<LayerError>);
+BENCHMARK(widenAssign<FatLayerError>);
+
+}  // namespace result::bench
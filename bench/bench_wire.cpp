@@ -0,0 +1,70 @@
+#include "result/result.h"
+#include "result/wire.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace result::bench {
+
+struct WireError {
+    int32_t code = 0;
+};
+
+}  // namespace result::bench
+
+template <>
+struct result::wire::RawBytes<result::bench::WireError> : std::true_type {};
+
+namespace result::bench {
+
+using Wired = Result<int64_t, WireError>;
+
+std::vector<Wired> makeWired(size_t n) {
+    std::vector<Wired> rs;
+    rs.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (i % 16 == 0) {
+            rs.emplace_back(makeError(WireError{static_cast<int32_t>(i)}));
+        } else {
+            rs.emplace_back(static_cast<int64_t>(i));
+        }
+    }
+    return rs;
+}
+
+void wireEncode(benchmark::State& state) {
+    const auto rs = makeWired(1 << 20);
+    std::vector<std::byte> bytes(wire::encodedSize(std::span<const Wired>(rs)).value());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wire::encodeBatch(std::span<const Wired>(rs), bytes.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+
+void wireDecode(benchmark::State& state) {
+    const auto rs = makeWired(1 << 20);
+    std::vector<std::byte> bytes(wire::encodedSize(std::span<const Wired>(rs)).value());
+    wire::encodeBatch(std::span<const Wired>(rs), bytes.data());
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        auto count = wire::decodeBatch<Wired>(bytes, [&](wire::View<Wired> view) {
+            sum += view.hasValue() ? *view.value() : 0;
+        });
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+
+BENCHMARK(wireEncode);
+BENCHMARK(wireDecode);
+
+}  // namespace result::bench
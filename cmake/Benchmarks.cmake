@@ -0,0 +1,5 @@
+option(VOE_BUILD_BENCHMARKS "Build benchmarks" OFF)
+
+if(VOE_BUILD_BENCHMARKS AND (VOE_SOURCE_DIR STREQUAL CMAKE_SOURCE_DIR))
+  add_subdirectory(bench)
+endif()
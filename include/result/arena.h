@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+
+namespace result {
+
+/**
+ * @brief Thread-local monotonic arena for error payloads of a single request
+ *
+ * Allocations bump a pointer in a per-thread buffer and never contend across threads.
+ * Memory is reclaimed all at once by reset(), so errors allocated from the arena
+ * must not outlive the request:
+ * @code
+ * Result<Response, std::pmr::string> handle(const Request& request) {
+ *     ErrorArena::Scope scope;
+ *     auto alloc = ErrorArena::local().allocator();
+ *     ...
+ *     return makeError<std::pmr::string>(std::allocator_arg, alloc, "malformed header");
+ * }
+ * @endcode
+ */
+class ErrorArena {
+ public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;  // NOLINT
+
+    static constexpr size_t InitialSize = 4096;
+
+    // Resets the arena of the current thread on exit. A monotonic arena has no watermark
+    // to go back to, so scopes do not nest: only the outermost request scope has one.
+    class Scope {
+     public:
+        Scope() noexcept {
+            ErrorArena& arena = ErrorArena::local();
+            assert(!arena.scoped_ && "ErrorArena::Scope does not nest");
+            arena.scoped_ = true;
+        }
+
+        // Pinned
+        Scope(Scope&&) = delete;
+        Scope(Scope const&) = delete;
+        Scope& operator=(Scope const&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        ~Scope() noexcept {
+            ErrorArena& arena = ErrorArena::local();
+            arena.scoped_ = false;
+            arena.reset();
+        }
+    };
+
+    ErrorArena() noexcept
+        : resource_(buffer_.data(), buffer_.size(), std::pmr::new_delete_resource()) {}
+
+    // Pinned
+    ErrorArena(ErrorArena&&) = delete;
+    ErrorArena(ErrorArena const&) = delete;
+    ErrorArena& operator=(ErrorArena const&) = delete;
+    ErrorArena& operator=(ErrorArena&&) = delete;
+
+    static ErrorArena& local() noexcept {
+        thread_local ErrorArena arena;
+        return arena;
+    }
+
+    allocator_type allocator() noexcept {
+        return allocator_type(&resource_);
+    }
+
+    std::pmr::memory_resource* resource() noexcept {
+        return &resource_;
+    }
+
+    // Frees everything allocated so far, the initial buffer is reused
+    void reset() noexcept {
+        resource_.release();
+    }
+
+ private:
+    alignas(std::max_align_t) std::array<std::byte, InitialSize> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+    bool scoped_ = false;
+};
+
+}  // namespace result
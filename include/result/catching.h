@@ -0,0 +1,103 @@
+#pragma once
+
+#include "result/detail/attributes.h"
+#include "result/detail/propagate_category.h"
+#include "result/error/exception.h"
+#include "result/result.h"
+#include "result/traits.h"
+#include "result/union.h"
+
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+template <typename X, typename... Es>
+struct CatchingResultFor {
+    using type = Result<std::decay_t<X>, Es...>;
+};
+
+template <typename... Es>
+struct CatchingResultFor<void, Es...> {
+    using type = Result<Unit, Es...>;
+};
+
+template <typename V, typename... Gs, typename... Es>
+struct CatchingResultFor<Result<V, Gs...>, Es...> {
+    using type = Union<V, Result<V, Gs...>, Es...>;
+};
+
+// Called from a handler: maps the exception in flight to the first of Es it is caught as,
+// or rethrows it
+template <typename Ret, typename E, typename... Rest>
+RESULT_COLD Ret mapCurrentException() {
+    if constexpr (std::is_same_v<E, ExceptionError>) {
+        return makeError(ExceptionError(std::current_exception()));
+    } else {
+        try {
+            throw;
+        } catch (E& e) {
+            return makeError(std::move(e));
+        } catch (...) {
+            if constexpr (sizeof...(Rest) > 0) {
+                return mapCurrentException<Ret, Rest...>();
+            } else {
+                throw;
+            }
+        }
+    }
+}
+
+template <typename F, typename... Es>
+class Catching {
+ public:
+    explicit Catching(F f) : f_(std::move(f)) {}
+
+    template <typename Self, typename... Args>
+    auto operator()(this Self&& self, Args&&... args) {
+        using X = std::invoke_result_t<propagateCategory<Self&&, F>, Args&&...>;
+        using Ret = typename CatchingResultFor<std::remove_cvref_t<X>, Es...>::type;
+
+        // Nothing but unwind tables when nothing throws
+        try {
+            if constexpr (std::is_void_v<X>) {
+                std::invoke(std::forward_like<Self>(self.f_), std::forward<Args>(args)...);
+                return Ret(unit);
+            } else {
+                return Ret(
+                    std::invoke(std::forward_like<Self>(self.f_), std::forward<Args>(args)...));
+            }
+        } catch (...) {
+            return mapCurrentException<Ret, Es...>();
+        }
+    }
+
+ private:
+    F f_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Wraps a throwing function into one returning a Result
+ *
+ * Exceptions caught as one of Es become that error, the first matching type winning like
+ * in a sequence of catch clauses. ExceptionError catches anything, other exceptions
+ * propagate. A Result returned by f gets its errors merged with Es:
+ * @code
+ * auto read = catching<std::system_error, ExceptionError>(&legacy::File::read);
+ * Result<std::string, std::system_error, ExceptionError> text = read(file, offset);
+ * @endcode
+ * Use valueOrThrow() for the reverse direction.
+ */
+template <typename... Es, typename F>
+requires(sizeof...(Es) > 0)
+auto catching(F f) {
+    return detail::Catching<F, Es...>(std::move(f));
+}
+
+}  // namespace result
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "result/relocate.h"
+#include "result/traits.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+enum class ChannelMode {
+    KeepOpen,
+    // The first error sent is delivered, and closes the channel behind it
+    CloseOnError,
+};
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue of Results
+ *
+ * Each slot has a sequence number telling whether it awaits a producer or a consumer
+ * of the current lap (D. Vyukov's bounded MPMC queue), so that senders and receivers
+ * contend on one counter each, with a single CAS per batch. Slots take whole cache lines,
+ * and received Results are relocated out of them with memcpy when trivially relocatable.
+ * Blocking calls wait by yielding.
+ * @code
+ * Channel<Result<Row, IoError>> rows(1024, ChannelMode::CloseOnError);
+ *
+ * // Producers
+ * rows.sendBatch(parsed);
+ *
+ * // Consumers
+ * std::vector<Result<Row, IoError>> batch(64);
+ * while (size_t n = rows.recvBatch(batch)) {
+ *     ...
+ * }
+ * @endcode
+ */
+template <SomeResult R>
+class Channel {
+    // Slots are claimed before they are filled, a throwing move would leave a hole
+    static_assert(std::is_nothrow_move_constructible_v<R>);
+
+ public:
+    // Rounded up to a power of two
+    explicit Channel(size_t capacity, ChannelMode mode = ChannelMode::KeepOpen)
+        : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          mode_(mode),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Pinned
+    Channel(Channel&&) = delete;
+    Channel(Channel const&) = delete;
+    Channel& operator=(Channel const&) = delete;
+    Channel& operator=(Channel&&) = delete;
+
+    ~Channel() {
+        const size_t end = enqueue_.load(std::memory_order_relaxed) & ~Closed;
+        for (size_t pos = dequeue_.load(std::memory_order_relaxed); pos != end; ++pos) {
+            std::destroy_at(slots_[pos & mask_].get());
+        }
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    // Sends that start after close() returns fail, receivers get what was sent before
+    void close() noexcept {
+        enqueue_.fetch_or(Closed, std::memory_order_acq_rel);
+    }
+
+    [[nodiscard]] bool closed() const noexcept {
+        return (enqueue_.load(std::memory_order_acquire) & Closed) != 0;
+    }
+
+    // Moves from r only if sent, fails when the channel is full or closed
+    bool trySend(R&& r) {
+        return putSome(std::span<R>(&r, 1)) == 1;
+    }
+
+    // Waits while the channel is full, fails when it is closed
+    bool send(R&& r) {
+        return sendBatch(std::span<R>(&r, 1)) == 1;
+    }
+
+    // Sends items in order, waiting while the channel is full. Returns how many were sent:
+    // fewer than all if the channel was closed, by this batch in CloseOnError mode included
+    size_t sendBatch(std::span<R> items) {
+        size_t sent = 0;
+        while (sent < items.size()) {
+            const size_t n = putSome(items.subspan(sent));
+            sent += n;
+
+            if (n == 0) {
+                if (closed()) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+        return sent;
+    }
+
+    std::optional<R> tryRecv() {
+        std::optional<R> out;
+        takeSome(1, [&](size_t, R* from) {
+            out.emplace(std::move(*from));
+            std::destroy_at(from);
+        });
+        return out;
+    }
+
+    // Waits while the channel is empty, returns nothing once it is closed and drained
+    std::optional<R> recv() {
+        while (true) {
+            if (auto out = tryRecv()) {
+                return out;
+            }
+            if (drained()) {
+                return std::nullopt;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Moves up to out.size() Results into out, waiting for at least one.
+    // Returns 0 only once the channel is closed and drained.
+    size_t recvBatch(std::span<R> out) {
+        if (out.empty()) {
+            return 0;
+        }
+
+        auto take = [&](size_t i, R* from) { moveOut(from, &out[i]); };
+        while (true) {
+            if (const size_t n = takeSome(out.size(), take)) {
+                return n;
+            }
+            if (drained()) {
+                return 0;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+ private:
+    static constexpr size_t Closed = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+    struct alignas(64) Slot {
+        // pos: awaits the producer of pos, pos + 1: holds the Result for the consumer of pos
+        std::atomic<size_t> sequence;
+        alignas(R) std::byte storage[sizeof(R)];
+
+        R* get() noexcept {
+            return std::launder(reinterpret_cast<R*>(storage));
+        }
+    };
+
+    static ptrdiff_t lag(size_t sequence, size_t expected) noexcept {
+        return static_cast<ptrdiff_t>(sequence - expected);
+    }
+
+    // Claims the longest run of free slots at the head, up to the first error in
+    // CloseOnError mode, and moves items into them
+    size_t putSome(std::span<R> items) {
+        bool closes = false;
+        if (mode_ == ChannelMode::CloseOnError) {
+            auto failed = std::ranges::find_if(items, [](const R& r) { return r.hasAnyError(); });
+            if (failed != items.end()) {
+                items = items.first(static_cast<size_t>(failed - items.begin()) + 1);
+                closes = true;
+            }
+        }
+
+        // A run ending in the error closes the channel in the same CAS, so that no other
+        // producer can claim a slot behind it
+        const auto [pos, n] = claim(enqueue_, items.size(), 0, closes);
+
+        for (size_t i = 0; i < n; ++i) {
+            Slot& slot = slots_[(pos + i) & mask_];
+            std::construct_at(slot.get(), std::move(items[i]));
+            slot.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // Claims the longest run of filled slots at the tail, up to max, and passes them to
+    // take(i, from), which ends the lifetime of *from
+    template <typename Take>
+    size_t takeSome(size_t max, Take&& take) {
+        const auto [pos, n] = claim(dequeue_, max, 1, false);
+
+        for (size_t i = 0; i < n; ++i) {
+            Slot& slot = slots_[(pos + i) & mask_];
+            take(i, slot.get());
+            slot.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    struct Claimed {
+        size_t pos;
+        size_t count;
+    };
+
+    // Advances counter over up to max slots ready for this lap, whose sequence is pos + ready.
+    // Claims nothing if the slot at the counter is not ready, or if the channel is closed
+    // when claiming for sending. Sets Closed along with the advance if all max are claimed
+    // and close_at_max.
+    Claimed claim(std::atomic<size_t>& counter, size_t max, size_t ready, bool close_at_max) {
+        size_t pos = counter.load(std::memory_order_relaxed);
+        while (true) {
+            if ((pos & Closed) != 0 || max == 0) {
+                return {pos, 0};
+            }
+
+            size_t n = 0;
+            while (n < max && sequenceAt(pos + n) == pos + n + ready) {
+                ++n;
+            }
+
+            if (n == 0) {
+                // Behind by a lap: the slot is still full (sending) or not yet filled (receiving)
+                if (lag(sequenceAt(pos), pos + ready) < 0) {
+                    return {pos, 0};
+                }
+                pos = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            const size_t next = (n == max && close_at_max) ? ((pos + n) | Closed) : pos + n;
+            if (counter.compare_exchange_weak(pos, next, std::memory_order_relaxed)) {
+                return {pos, n};
+            }
+        }
+    }
+
+    size_t sequenceAt(size_t pos) const noexcept {
+        return slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+    }
+
+    // Ends the lifetime of *from, replacing *to with it
+    static void moveOut(R* from, R* to) {
+        if constexpr (isTriviallyRelocatable<R>) {
+            std::destroy_at(to);
+            relocateAt(from, to);
+        } else {
+            *to = std::move(*from);
+            std::destroy_at(from);
+        }
+    }
+
+    // Closed, and every Result sent before was received
+    bool drained() const noexcept {
+        const size_t enqueue = enqueue_.load(std::memory_order_acquire);
+        return (enqueue & Closed) != 0 &&
+               dequeue_.load(std::memory_order_acquire) == (enqueue & ~Closed);
+    }
+
+    const size_t mask_;
+    const ChannelMode mode_;
+    std::unique_ptr<Slot[]> slots_;
+
+    // Next position to send to, with the Closed bit
+    alignas(64) std::atomic<size_t> enqueue_{0};
+
+    // Next position to receive from
+    alignas(64) std::atomic<size_t> dequeue_{0};
+};
+
+}  // namespace result
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "result/detail/overloaded.h"
+#include "result/error/any_error.h"
+#include "result/traits.h"
+
+namespace result {
+
+namespace pipe {
+
+struct [[nodiscard]] EraseErrors {
+    static constexpr bool RunsOnErrors = true;
+
+    template <SomeResult R>
+    auto pipe(R r) const {
+        using V = typename R::value_type;
+        using Ret = Result<V, AnyError>;
+
+        return std::move(r).taggedVisit(detail::Overloaded{
+            [](val_tag_t, V value) -> Ret { return std::move(value); },
+            [](auto err) -> Ret {
+                using E = decltype(err);
+
+                if constexpr (std::is_same_v<E, AnyError>) {
+                    return Ret(detail::pass_tag<AnyError>, std::move(err));
+                } else {
+                    return Ret(detail::pass_tag<AnyError>, std::in_place_type<E>, std::move(err));
+                }
+            },
+        });
+    }
+};
+
+}  // namespace pipe
+
+// Result<T, Es...> -> Result<T, AnyError>
+inline auto eraseErrors() {
+    return pipe::EraseErrors{};
+}
+
+}  // namespace result
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "result/metrics/stage.h"
+#include "result/traits.h"
+
+#include <chrono>
+#include <string_view>
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+// Which inputs a stage does work for: values, unless it declares otherwise like mapErr,
+// and errors if it declares so like orElse
+template <typename P>
+constexpr bool RunsOnValues = [] {
+    if constexpr (requires { P::RunsOnValues; }) {
+        return P::RunsOnValues;
+    } else {
+        return true;
+    }
+}();
+
+template <typename P>
+constexpr bool RunsOnErrors = [] {
+    if constexpr (requires { P::RunsOnErrors; }) {
+        return P::RunsOnErrors;
+    } else {
+        return false;
+    }
+}();
+
+}  // namespace detail
+
+namespace pipe {
+
+template <typename P>
+struct [[nodiscard]] Instrumented {
+    StageStats* stage;
+    P inner;
+
+    static constexpr bool RunsOnValues = detail::RunsOnValues<P>;
+    static constexpr bool RunsOnErrors = detail::RunsOnErrors<P>;
+
+    Instrumented(StageStats& s, P p) : stage(&s), inner(std::move(p)) {}
+
+    // Results the stage only passes through are not timed
+    template <SomeResult R, typename Self>
+    auto pipe(this Self&& self, R r) {
+        using Clock = std::chrono::steady_clock;
+
+        if (r.hasAnyError() ? !RunsOnErrors : !RunsOnValues) {
+            return std::forward<Self>(self).inner.pipe(std::move(r));
+        }
+
+        const auto start = Clock::now();
+        auto out = std::forward<Self>(self).inner.pipe(std::move(r));
+        self.stage->record(out.hasAnyError(), Clock::now() - start);
+        return out;
+    }
+};
+
+}  // namespace pipe
+
+// Records latencies of `p` into `stage`, split by whether it produced a value or an error
+template <typename P>
+auto instrumented(StageStats& stage, P p) {
+    return pipe::Instrumented<P>(stage, std::move(p));
+}
+
+// Same, with the stage of the global StageRegistry named `name`
+template <typename P>
+auto instrumented(std::string_view name, P p) {
+    return pipe::Instrumented<P>(detail::globalStage(name), std::move(p));
+}
+
+}  // namespace result
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "result/detail/attributes.h"
 #include "result/detail/overloaded.h"
 #include "result/traits.h"
 
@@ -25,7 +26,10 @@ struct [[nodiscard]] Map {
             [&](val_tag_t, auto value) -> Ret {
                 return std::forward<Self>(self).user(std::move(value));
             },
-            [&](auto error) -> Ret { return makeError(std::move(error)); },
+            [&] RESULT_COLD (auto error) -> Ret {
+                using E = typename Ret::template StoredError<decltype(error)>;
+                return Ret(detail::pass_tag<E>, std::move(error));
+            },
         });
     }
 };
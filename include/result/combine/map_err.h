@@ -1,6 +1,8 @@
 #pragma once
 
+#include "result/detail/allocator.h"
 #include "result/detail/apply_to_template.h"
+#include "result/detail/attributes.h"
 #include "result/detail/overloaded.h"
 #include "result/result.h"
 #include "result/traits.h"
@@ -9,23 +11,29 @@ namespace result {
 
 namespace pipe {
 
-template <typename F>
+template <typename F, typename Alloc = detail::NoAllocator>
 struct [[nodiscard]] MapErr {
-    // F: Es... -> Gs... (multiple overloads)
+    // F: Es... -> Gs... (multiple overloads), optionally taking the allocator as the last argument.
+    // Wrapped errors such as Shared<E> are passed as their payload.
     F user;
+    [[no_unique_address]] Alloc alloc;
 
     template <typename R>
     using Es = ErrorTypesOf<R>;  // tl::List
 
     struct ErrMapper {
         template <typename E>
-        using Map = std::invoke_result_t<F, E>;
+        using Map =
+            std::decay_t<detail::InvokeWithAllocatorResult<F, Alloc, detail::SeenThrough<E>>>;
     };
 
     template <typename R>
     using Gs = tl::Map<ErrMapper, Es<R>>;
 
-    explicit MapErr(F u) : user(std::move(u)) {}
+    static constexpr bool RunsOnValues = false;
+    static constexpr bool RunsOnErrors = true;
+
+    explicit MapErr(F u, Alloc a = {}) : user(std::move(u)), alloc(std::move(a)) {}
 
     template <SomeResult R, typename Self>
     auto pipe(this Self&& self, R r) {
@@ -34,8 +42,13 @@ struct [[nodiscard]] MapErr {
 
         return std::move(r).taggedVisit(detail::Overloaded{
             [](val_tag_t, V value) -> Ret { return std::move(value); },
-            [&](auto err) -> Ret {
-                return makeError(std::forward<Self>(self).user(std::move(err)));
+            [&] RESULT_COLD (auto err) -> Ret {
+                return detail::makeErrorWith(
+                    self.alloc,
+                    detail::invokeWithAllocator(
+                        std::forward<Self>(self).user,
+                        self.alloc,
+                        detail::seeThrough(std::move(err))));
             },
         });
     }
@@ -49,4 +62,10 @@ auto mapErr(F user) {
     return pipe::MapErr{std::move(user)};
 }
 
+// Same, mapped errors are constructed using `alloc`, which is also passed to F if it takes one
+template <typename Alloc, typename F>
+auto mapErr(std::allocator_arg_t, Alloc alloc, F user) {
+    return pipe::MapErr<F, Alloc>{std::move(user), std::move(alloc)};
+}
+
 }  // namespace result
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "result/detail/allocator.h"
 #include "result/detail/apply_to_template.h"
 #include "result/detail/overloaded.h"
 #include "result/traits.h"
@@ -8,17 +9,20 @@ namespace result {
 
 namespace pipe {
 
-template <typename F>
+template <typename F, typename Alloc = detail::NoAllocator>
 struct [[nodiscard]] OrElse {
-    // Es... -> Result<T, Gs...>
+    // Es... -> Result<T, Gs...>, optionally taking the allocator as the last argument.
+    // Wrapped errors such as Shared<E> are passed as their payload.
     F user;
+    [[no_unique_address]] Alloc alloc;
 
     template <typename R>
     using Es = ErrorTypesOf<R>;
 
     struct ErrMapper {
         template <typename E>
-        using Map = ErrorTypesOf<std::invoke_result_t<F, E>>;
+        using Map = ErrorTypesOf<
+            std::decay_t<detail::InvokeWithAllocatorResult<F, Alloc, detail::SeenThrough<E>>>>;
     };
 
     template <typename R>
@@ -27,7 +31,10 @@ struct [[nodiscard]] OrElse {
     template <typename R>
     using Gs = tl::Unique<tl::Flatten<GsThick<R>>>;
 
-    explicit OrElse(F u) : user(std::move(u)) {}
+    static constexpr bool RunsOnValues = false;
+    static constexpr bool RunsOnErrors = true;
+
+    explicit OrElse(F u, Alloc a = {}) : user(std::move(u)), alloc(std::move(a)) {}
 
     template <SomeResult R, typename Self>
     auto pipe(this Self&& self, R r) {
@@ -36,7 +43,19 @@ struct [[nodiscard]] OrElse {
 
         return std::move(r).taggedVisit(detail::Overloaded{
             [](val_tag_t, V value) -> Ret { return std::move(value); },
-            [&](auto err) -> Ret { return std::forward<Self>(self).user(std::move(err)); },
+            [&](auto err) -> Ret {
+                if constexpr (std::is_same_v<Alloc, detail::NoAllocator>) {
+                    return std::forward<Self>(self).user(detail::seeThrough(std::move(err)));
+                } else {
+                    return Ret(
+                        std::allocator_arg,
+                        self.alloc,
+                        detail::invokeWithAllocator(
+                            std::forward<Self>(self).user,
+                            self.alloc,
+                            detail::seeThrough(std::move(err))));
+                }
+            },
         });
     }
 };
@@ -49,4 +68,11 @@ auto orElse(F user) {
     return pipe::OrElse{std::move(user)};
 }
 
+// Same, errors of the returned Results are constructed using `alloc`,
+// which is also passed to F if it takes one
+template <typename Alloc, typename F>
+auto orElse(std::allocator_arg_t, Alloc alloc, F user) {
+    return pipe::OrElse<F, Alloc>{std::move(user), std::move(alloc)};
+}
+
 }  // namespace result
@@ -3,9 +3,10 @@
 #include "result/coro/awaitable.h"
 #include "result/coro/promise.h"
 
-template <typename T, typename... Es>
-auto operator co_await(result::Result<T, Es...> o) {
-    return ::result::detail::ResultAwaitable<T, Es...>{std::move(o)};
+template <typename R>
+requires result::SomeResult<std::decay_t<R>>
+auto operator co_await(R&& o) {
+    return ::result::detail::ResultAwaitable<R&&>{std::forward<R>(o)};
 }
 
 namespace std {
@@ -7,29 +7,36 @@
 
 namespace result::detail {
 
-template <typename T, typename... Es>
+// R is a reference to the awaited Result: the co_await operand outlives the whole
+// suspend-resume cycle, so neither values nor errors are moved into the awaitable
+template <typename R>
 struct ResultAwaitable {
-    Result<T, Es...> object;
+    using T = typename std::decay_t<R>::value_type;
+
+    R object;
 
     bool await_ready() noexcept {  // NOLINT
         return !object.hasAnyError();
     }
 
-    T await_resume() {  // NOLINT
+    // Lvalue results are observed in place, rvalue results give their value away
+    std::conditional_t<std::is_lvalue_reference_v<R>, decltype(std::declval<R>().value()), T>
+    await_resume() {  // NOLINT
         assert(!object.hasAnyError());
-        return std::move(object).value();
+        return std::forward<R>(object).value();
     }
 
-    template <typename U, typename... Gs>
-    void await_suspend(std::coroutine_handle<ResultPromise<U, Gs...>> h) {  // NOLINT
-        auto&& promise = h.promise();
-        auto* owner = promise.owner;
-        assert(owner);
+    // Promise finishes the coroutine with the error and tells where to go next
+    template <typename Promise>
+    auto await_suspend(std::coroutine_handle<Promise> h) {  // NOLINT
+        auto& promise = h.promise();
 
-        std::move(object).taggedVisit(detail::Overloaded{
-            [](val_tag_t, auto) { std::unreachable(); },
-            [&](auto error) { owner->assign(makeError(std::move(error))); },
+        std::forward<R>(object).taggedVisit(detail::Overloaded{
+            [](val_tag_t, auto&&) { std::unreachable(); },
+            [&]<typename G>(G&& error) { promise.returnError(std::forward<G>(error)); },
         });
+
+        return promise.unwind();
     }
 };
 
@@ -1,7 +1,9 @@
 #pragma once
 
-#include "result/coro/return_object_holder.h"
+#include "result/coro/return_slot.h"
+#include "result/error/exception.h"
 #include "result/result.h"
+#include "result/traits.h"
 
 #include <coroutine>
 #include <exception>
@@ -13,7 +15,7 @@ struct ResultPromiseBase {
     ResultPromiseBase() = default;
 
     auto get_return_object() noexcept {  // NOLINT
-        return detail::ReturnedObjectHolder{&owner};
+        return slot.makeReturnObject();
     }
 
     auto initial_suspend() noexcept {  // NOLINT
@@ -24,27 +26,51 @@ struct ResultPromiseBase {
         return std::suspend_never{};
     }
 
-    [[noreturn]] void unhandled_exception() noexcept {  // NOLINT
-        // exceptions are not yet supported
-        std::terminate();
+    // Exceptions escaping the body are returned when ExceptionError is one of Es
+    void unhandled_exception() noexcept {  // NOLINT
+        if constexpr (tl::Contains<tl::List<Es...>, ExceptionError>) {
+            slot.emplace(err_tag<ExceptionError>, std::current_exception());
+        } else {
+            std::terminate();
+        }
     }
 
-    detail::ReturnedObjectHolder<Result<T, Es...>>* owner = nullptr;
+    detail::ReturnSlot<Result<T, Es...>> slot;
 };
 
 template <typename T, typename... Es>
 struct ResultPromise : ResultPromiseBase<T, Es...> {
     ResultPromise() = default;
 
-    void return_value(T x) {  // NOLINT
-        assert(this->owner);
-        this->owner->assign(std::move(x));
+    template <typename U = T>
+    requires(!SomeResult<std::decay_t<U>>) && std::is_constructible_v<T, U>
+    void return_value(U&& x) {  // NOLINT
+        this->slot.emplace(std::in_place, std::forward<U>(x));
     }
 
-    void return_value(Result<T, Es...> x) {  // NOLINT
-        assert(this->owner);
-        this->owner->assign(std::move(x));
+    template <ConvertibleTo<Result<T, Es...>> R>
+    void return_value(R&& x) {  // NOLINT
+        this->slot.emplace(std::forward<R>(x));
+    }
+
+    template <typename G>
+    void returnError(G&& error) {
+        using E = typename Result<T, Es...>::template StoredError<std::decay_t<G>>;
+        this->slot.emplace(detail::pass_tag<E>, std::forward<G>(error));
+    }
+
+    // The error is already in the caller's hands, the coroutine will never be resumed
+    void unwind() noexcept {
+        std::coroutine_handle<ResultPromise>::from_promise(*this).destroy();
     }
 };
 
+// Result coroutines run to completion before returning, so they cannot await what suspends,
+// such as a Task
+template <typename P>
+constexpr bool IsResultPromise = false;
+
+template <typename T, typename... Es>
+constexpr bool IsResultPromise<ResultPromise<T, Es...>> = true;
+
 }  // namespace result::detail
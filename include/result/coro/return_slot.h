@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Whether the prvalue returned by get_return_object() initializes the object returned by
+// the coroutine call directly when both have the same type (CWG2563). Clang does so since 17;
+// elsewhere the result is staged and moved out once, see detail::StagedReturn.
+#ifndef RESULT_CORO_DIRECT_RETURN
+#if defined(__clang__) && __clang_major__ >= 17
+#define RESULT_CORO_DIRECT_RETURN 1
+#else
+#define RESULT_CORO_DIRECT_RETURN 0
+#endif
+#endif
+
+namespace result::detail {
+
+template <typename R>
+class ReturnSlot;
+
+// Object returned by get_return_object() where it is not the caller's object. Lives in the
+// ramp of the coroutine until the call returns, and is then converted to R.
+template <typename R>
+class StagedReturn {
+ public:
+    explicit StagedReturn(ReturnSlot<R>& slot) noexcept {
+        slot.bind(get());
+    }
+
+    // Pinned
+    StagedReturn(StagedReturn&&) = delete;
+    StagedReturn(StagedReturn const&) = delete;
+    StagedReturn& operator=(StagedReturn const&) = delete;
+    StagedReturn& operator=(StagedReturn&&) = delete;
+
+    // Called once, after the body filled the slot
+    /* implicit */ operator R() && {  // NOLINT
+        R out(std::move(*get()));
+        std::destroy_at(get());
+        return out;
+    }
+
+ private:
+    R* get() noexcept {
+        return std::launder(reinterpret_cast<R*>(storage_));  // NOLINT
+    }
+
+    alignas(R) std::byte storage_[sizeof(R)];
+};
+
+// Address of the object returned to the caller of a Result coroutine.
+// Returned values and errors are constructed right in that object, without staging.
+//
+// Every path through the body fills it exactly once before the call returns: co_return,
+// a failed co_await or unhandled_exception(). Until then the object has no alternative.
+template <typename R>
+class ReturnSlot {
+ public:
+#if RESULT_CORO_DIRECT_RETURN
+    using ReturnObject = R;
+#else
+    using ReturnObject = StagedReturn<R>;
+#endif
+
+    ReturnSlot() = default;
+
+    // Pinned
+    ReturnSlot(ReturnSlot&&) = delete;
+    ReturnSlot(ReturnSlot const&) = delete;
+    ReturnSlot& operator=(ReturnSlot const&) = delete;
+    ReturnSlot& operator=(ReturnSlot&&) = delete;
+
+    // With RESULT_CORO_DIRECT_RETURN, R is the declared return type of the coroutine,
+    // and the returned prvalue is the result object of the coroutine call
+    ReturnObject makeReturnObject() noexcept {
+        return ReturnObject(*this);
+    }
+
+    void bind(R* object) noexcept {
+        assert(object_ == nullptr);
+        object_ = object;
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        assert(object_ != nullptr);
+        new (object_) R(std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] const void* address() const noexcept {
+        return object_;
+    }
+
+ private:
+    R* object_ = nullptr;
+};
+
+}  // namespace result::detail
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result::detail {
+
+// Stands for the absence of an allocator in allocator-aware pipes
+struct NoAllocator {};
+
+// Constructs U at `at` from the uses-allocator construction arguments of T
+template <typename T, typename U, typename Alloc, typename... Args>
+void constructUsingAllocator(void* at, const Alloc& alloc, Args&&... args) {
+    std::apply(
+        [at](auto&&... xs) { new (at) U(std::forward<decltype(xs)>(xs)...); },
+        std::uses_allocator_construction_args<T>(alloc, std::forward<Args>(args)...));
+}
+
+// Passes the allocator as the trailing argument to functions that accept one
+template <typename F, typename Alloc, typename... Args>
+decltype(auto) invokeWithAllocator(F&& f, const Alloc& alloc, Args&&... args) {
+    if constexpr (
+        !std::is_same_v<Alloc, NoAllocator> && std::is_invocable_v<F, Args..., const Alloc&>) {
+        return std::invoke(std::forward<F>(f), std::forward<Args>(args)..., alloc);
+    } else {
+        return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+}
+
+template <typename F, typename Alloc, typename... Args>
+using InvokeWithAllocatorResult = decltype(invokeWithAllocator(
+    std::declval<F>(), std::declval<const Alloc&>(), std::declval<Args>()...));
+
+}  // namespace result::detail
@@ -0,0 +1,28 @@
+#pragma once
+
+// Forces inlining even at -O0, where the calls through one-line accessors and dispatch
+// helpers dominate. Define RESULT_ALWAYS_INLINE as empty to step into them in a debugger.
+#ifndef RESULT_ALWAYS_INLINE
+#if defined(__GNUC__) || defined(__clang__)
+#define RESULT_ALWAYS_INLINE [[gnu::always_inline]]
+#else
+#define RESULT_ALWAYS_INLINE
+#endif
+#endif
+
+// Outlines error-side code into noinline helpers the compiler places in .text.unlikely, keeping
+// it out of the value path's icache footprint and inlining budget. Define RESULT_COLD as empty
+// where errors are the common case.
+#ifndef RESULT_COLD
+#if defined(__GNUC__) || defined(__clang__)
+#define RESULT_COLD [[gnu::cold, gnu::noinline]]
+#else
+#define RESULT_COLD
+#endif
+#endif
+
+// Calls the error hook of result/sampling.h on every error made. Off by default, so making
+// an error costs nothing more; define it to 1 for the whole program to use ErrorSampler.
+#ifndef RESULT_ERROR_SAMPLING
+#define RESULT_ERROR_SAMPLING 0
+#endif
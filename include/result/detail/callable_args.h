@@ -0,0 +1,44 @@
+#pragma once
+
+#include <type_list/list.h>
+
+namespace result::detail {
+
+namespace impl {
+
+template <typename F>
+struct CallableArgs : CallableArgs<decltype(&F::operator())> {};
+
+template <typename R, typename... Args>
+struct CallableArgs<R(Args...)> {
+    using type = tl::List<Args...>;
+};
+
+template <typename R, typename... Args>
+struct CallableArgs<R(Args...) noexcept> : CallableArgs<R(Args...)> {};
+
+template <typename R, typename... Args>
+struct CallableArgs<R (*)(Args...)> : CallableArgs<R(Args...)> {};
+
+template <typename R, typename... Args>
+struct CallableArgs<R (*)(Args...) noexcept> : CallableArgs<R(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallableArgs<R (C::*)(Args...)> : CallableArgs<R(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallableArgs<R (C::*)(Args...) const> : CallableArgs<R(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallableArgs<R (C::*)(Args...) noexcept> : CallableArgs<R(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallableArgs<R (C::*)(Args...) const noexcept> : CallableArgs<R(Args...)> {};
+
+}  // namespace impl
+
+// Parameter types of a function or of a lambda with a non-template call operator
+template <typename F>
+using CallableArgs = typename impl::CallableArgs<F>::type;
+
+}  // namespace result::detail
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "result/detail/type_name.h"
+
+#include <algorithm>
+#include <format>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace result::detail {
+
+// Writes what the error tells about itself to out: its formatTo() or message(), its characters,
+// the value of an enum or of a formattable type, and else its type name
+template <typename E, typename Out>
+Out describeErrorTo(Out out, const E& error) {
+    if constexpr (requires { error.formatTo(std::move(out)); }) {
+        return error.formatTo(std::move(out));
+    } else if constexpr (requires { std::string_view(error.message()); }) {
+        return std::ranges::copy(std::string_view(error.message()), std::move(out)).out;
+    } else if constexpr (std::is_convertible_v<const E&, std::string_view>) {
+        return std::ranges::copy(std::string_view(error), std::move(out)).out;
+    } else if constexpr (std::is_enum_v<E>) {
+        return describeErrorTo(std::move(out), std::to_underlying(error));
+    } else if constexpr (std::formattable<E, char>) {
+        return std::format_to(std::move(out), "{}", error);
+    } else {
+        return std::ranges::copy(TypeName<E>, std::move(out)).out;
+    }
+}
+
+}  // namespace result::detail
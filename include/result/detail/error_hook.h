@@ -0,0 +1,40 @@
+#pragma once
+
+#include "result/detail/describe_error.h"
+#include "result/detail/type_name.h"
+#include "result/error/inline_message.h"
+
+#include <atomic>
+#include <iterator>
+#include <string_view>
+
+namespace result::detail {
+
+// Compact rendering of a sampled error, see result/sampling.h
+using ErrorRendering = InlineMessage<96>;
+
+using RenderError = void (*)(const void* error, ErrorRendering& out) noexcept;
+
+using ErrorHook = void (*)(std::string_view type, const void* error, RenderError render) noexcept;
+
+// Called on every error made with err_tag while set, nullptr when sampling is off.
+// Only with RESULT_ERROR_SAMPLING, see result/detail/attributes.h
+inline std::atomic<ErrorHook> error_hook{nullptr};  // NOLINT
+
+template <typename E>
+void renderError(const void* ptr, ErrorRendering& out) noexcept {
+    // Describing may allocate, the sample then keeps what was written before
+    try {
+        describeErrorTo(std::back_inserter(out), *static_cast<const E*>(ptr));
+    } catch (...) {
+    }
+}
+
+template <typename E>
+void onError(const E& error) noexcept {
+    if (ErrorHook hook = error_hook.load(std::memory_order_relaxed)) [[unlikely]] {
+        hook(TypeName<E>, &error, &renderError<E>);
+    }
+}
+
+}  // namespace result::detail
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+namespace result::detail {
+
+/**
+ * @brief Bounded lock-free queue for one producer and one consumer
+ *
+ * The producer never blocks: tryPush() fails when the ring is full.
+ * Head and tail live on separate cache lines, and the producer keeps a stale copy
+ * of the tail so that it reads the consumer's line only when the ring looks full.
+ */
+template <typename T, size_t Capacity>
+requires std::is_trivially_copyable_v<T>
+class SpscRing {
+    static_assert(std::has_single_bit(Capacity));
+
+ public:
+    SpscRing() = default;
+
+    // Pinned
+    SpscRing(SpscRing&&) = delete;
+    SpscRing(SpscRing const&) = delete;
+    SpscRing& operator=(SpscRing const&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+
+    // Producer only
+    bool tryPush(const T& x) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_cache_ == Capacity) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head - tail_cache_ == Capacity) {
+                return false;
+            }
+        }
+
+        slots_[head & (Capacity - 1)] = x;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only, passes every available element to `consume` and returns their number
+    template <typename F>
+    size_t drain(F&& consume) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t count = head - tail;
+
+        for (; tail != head; ++tail) {
+            consume(slots_[tail & (Capacity - 1)]);
+        }
+
+        tail_.store(tail, std::memory_order_release);
+        return count;
+    }
+
+ private:
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t tail_cache_ = 0;
+
+    alignas(64) std::atomic<size_t> tail_{0};
+
+    alignas(64) std::array<T, Capacity> slots_;
+};
+
+}  // namespace result::detail
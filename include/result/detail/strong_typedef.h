@@ -1,5 +1,8 @@
 #pragma once
 
+#include "result/detail/attributes.h"
+#include "result/detail/propagate_category.h"
+
 #include <type_traits>
 #include <utility>
 
@@ -12,9 +15,10 @@ class StrongTypedef {
     StrongTypedef(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
         : value_(std::forward<Args>(args)...) {}
 
+    // A cast rather than std::forward_like, which is a call of its own at -O0
     template <typename S>
-    decltype(auto) get(this S&& self) noexcept {  // NOLINT
-        return std::forward_like<S>(self.value_);
+    RESULT_ALWAYS_INLINE decltype(auto) get(this S&& self) noexcept {  // NOLINT
+        return static_cast<propagateCategory<S&&, T>>(self.value_);
     }
 
  private:
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string_view>
+
+namespace result::detail {
+
+// Human-readable name of T taken from the compiler's signature of this function
+template <typename T>
+constexpr std::string_view typeName() noexcept {
+    constexpr std::string_view Signature = __PRETTY_FUNCTION__;
+    constexpr auto Begin = Signature.find("T = ") + 4;
+    constexpr auto End = Signature.find_first_of("];", Begin);
+    return Signature.substr(Begin, End - Begin);
+}
+
+template <typename T>
+inline constexpr std::string_view TypeName = typeName<T>();
+
+}  // namespace result::detail
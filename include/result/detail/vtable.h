@@ -1,5 +1,6 @@
 #pragma once
 
+#include "result/detail/attributes.h"
 #include "result/detail/propagate_const.h"
 #include "result/detail/visit_result.h"
 
@@ -13,7 +14,7 @@ struct CallableFunctorArray {
     using ResultType = detail::VisitInvokeResult<FromVoid, Callable, Types...>;
 
     template <typename F>
-    static constexpr ResultType call(F&& func, FromVoid* ptr, size_t index) {
+    RESULT_ALWAYS_INLINE static constexpr ResultType call(F&& func, FromVoid* ptr, size_t index) {
         return Array[index](std::forward<F>(func), ptr);
     }
 
@@ -22,12 +23,13 @@ struct CallableFunctorArray {
     struct Call {
         using PointerType = propagateConst<Type, void>;
 
-        static constexpr decltype(auto) call(Callable callable, PointerType* ptr) {
+        // Takes the callable by reference, so that dispatching does not copy or move it
+        static constexpr decltype(auto) call(Callable&& callable, PointerType* ptr) {
             return std::forward<Callable>(callable)(*static_cast<Type*>(ptr));
         }
     };
 
-    using Fn = ResultType (*)(Callable, FromVoid*);
+    using Fn = ResultType (*)(Callable&&, FromVoid*);
 
     static constexpr Fn Array[sizeof...(Types)] = {
         Call<propagateConst<FromVoid, Types>>::call...,
@@ -40,7 +42,7 @@ concept SelfPtr = std::is_same_v<std::decay_t<T>, void>;
 template <typename... Ts>
 struct VTable {
     template <typename F, SelfPtr S>
-    static constexpr decltype(auto) dispatch(F&& f, S* self, size_t index) {
+    RESULT_ALWAYS_INLINE static constexpr decltype(auto) dispatch(F&& f, S* self, size_t index) {
         return CallableFunctorArray<S, F, Ts...>::call(std::forward<F>(f), self, index);
     }
 };
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+// Pointer-aligned, so that an AnyError is four pointers with no padding
+union AnyErrorStorage {
+    alignas(void*) std::byte buffer[3 * sizeof(void*)];
+    void* heap;
+};
+
+// Errors that do not fit, are over-aligned or may throw on move live on the heap
+template <typename E>
+inline constexpr bool AnyErrorStoredInline =
+    sizeof(E) <= sizeof(AnyErrorStorage::buffer) && alignof(E) <= alignof(AnyErrorStorage) &&
+    std::is_nothrow_move_constructible_v<E>;
+
+struct AnyErrorVTable {
+    void (*copy)(const AnyErrorStorage& from, AnyErrorStorage& to);
+    // Leaves `from` without an object
+    void (*move)(AnyErrorStorage& from, AnyErrorStorage& to) noexcept;
+    void (*destroy)(AnyErrorStorage& storage) noexcept;
+};
+
+template <typename E>
+struct AnyErrorOps {
+    template <typename... Args>
+    static void construct(AnyErrorStorage& storage, Args&&... args) {
+        if constexpr (AnyErrorStoredInline<E>) {
+            new (storage.buffer) E(std::forward<Args>(args)...);
+        } else {
+            storage.heap = new E(std::forward<Args>(args)...);
+        }
+    }
+
+    static E* pointer(AnyErrorStorage& storage) noexcept {
+        if constexpr (AnyErrorStoredInline<E>) {
+            return std::launder(reinterpret_cast<E*>(storage.buffer));  // NOLINT
+        } else {
+            return static_cast<E*>(storage.heap);
+        }
+    }
+
+    static const E* pointer(const AnyErrorStorage& storage) noexcept {
+        return pointer(const_cast<AnyErrorStorage&>(storage));  // NOLINT
+    }
+
+    static void copy(const AnyErrorStorage& from, AnyErrorStorage& to) {
+        construct(to, *pointer(from));
+    }
+
+    static void move(AnyErrorStorage& from, AnyErrorStorage& to) noexcept {
+        if constexpr (AnyErrorStoredInline<E>) {
+            construct(to, std::move(*pointer(from)));
+            pointer(from)->~E();
+        } else {
+            to.heap = std::exchange(from.heap, nullptr);
+        }
+    }
+
+    static void destroy(AnyErrorStorage& storage) noexcept {
+        if constexpr (AnyErrorStoredInline<E>) {
+            pointer(storage)->~E();
+        } else {
+            delete pointer(storage);
+        }
+    }
+};
+
+template <typename E>
+inline constexpr AnyErrorVTable AnyErrorVTableFor{
+    &AnyErrorOps<E>::copy,
+    &AnyErrorOps<E>::move,
+    &AnyErrorOps<E>::destroy,
+};
+
+}  // namespace detail
+
+/**
+ * @brief Type-erased error for wide error boundaries
+ *
+ * Holds an error of any copyable type, errors up to three pointers in size and aligned no more
+ * than a pointer are stored inline.
+ * Type queries compare a single vtable pointer:
+ * @code
+ * Result<Response, AnyError> call(const Request& request) {
+ *     return parse(request) | andThen(lookup) | map(render) | eraseErrors();
+ * }
+ *
+ * if (auto r = call(request); r.hasAnyError() && r.error<AnyError>().is<NotFound>()) { ... }
+ * @endcode
+ * A moved-from AnyError holds no error at all.
+ */
+class AnyError {
+ public:
+    template <typename E>
+    static constexpr bool StoredInline = detail::AnyErrorStoredInline<E>;
+
+    template <typename G, typename E = std::decay_t<G>>
+    requires(!std::is_same_v<E, AnyError>) && std::copy_constructible<E>
+    AnyError(G&& error)  // NOLINT
+        : AnyError(std::in_place_type<E>, std::forward<G>(error)) {}
+
+    template <std::copy_constructible E, typename... Args>
+    explicit AnyError(std::in_place_type_t<E>, Args&&... args)
+        : vtable_(&detail::AnyErrorVTableFor<E>) {
+        detail::AnyErrorOps<E>::construct(storage_, std::forward<Args>(args)...);
+    }
+
+    AnyError(const AnyError& other) : vtable_(other.vtable_) {
+        if (vtable_ != nullptr) {
+            vtable_->copy(other.storage_, storage_);
+        }
+    }
+
+    AnyError(AnyError&& other) noexcept {
+        take(other);
+    }
+
+    AnyError& operator=(const AnyError& other) {
+        if (this != &other) {
+            AnyError copy(other);
+            reset();
+            take(copy);
+        }
+        return *this;
+    }
+
+    AnyError& operator=(AnyError&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~AnyError() noexcept {
+        reset();
+    }
+
+    template <typename E>
+    [[nodiscard]] bool is() const noexcept {
+        return vtable_ == &detail::AnyErrorVTableFor<E>;
+    }
+
+    template <typename E, typename Self>
+    [[nodiscard]] decltype(auto) as(this Self&& self) noexcept {
+        assert(self.template is<E>());
+        return std::forward_like<Self>(*detail::AnyErrorOps<E>::pointer(self.storage_));
+    }
+
+    // nullptr unless an error of type E is held
+    template <typename E, typename Self>
+    [[nodiscard]] auto* tryAs(this Self& self) noexcept {
+        return self.template is<E>() ? detail::AnyErrorOps<E>::pointer(self.storage_) : nullptr;
+    }
+
+ private:
+    void take(AnyError& other) noexcept {
+        vtable_ = std::exchange(other.vtable_, nullptr);
+        if (vtable_ != nullptr) {
+            vtable_->move(other.storage_, storage_);
+        }
+    }
+
+    void reset() noexcept {
+        if (vtable_ != nullptr) {
+            std::exchange(vtable_, nullptr)->destroy(storage_);
+        }
+    }
+
+    detail::AnyErrorStorage storage_;
+    const detail::AnyErrorVTable* vtable_ = nullptr;
+};
+
+}  // namespace result
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace result {
+
+/**
+ * @brief Error holding an exception caught at a boundary
+ *
+ * Catches anything when listed in catching<Es...>(), and makes a Result coroutine, a Task
+ * or a Generator return the exceptions escaping its body instead of terminating, when among
+ * its error types. valueOrThrow() rethrows the exception itself:
+ * @code
+ * Result<Config, ParseError, ExceptionError> load(std::string_view path) {
+ *     auto text = co_await readFile(path);
+ *     co_return legacy::parseConfig(text);  // may throw
+ * }
+ * @endcode
+ */
+class ExceptionError {
+ public:
+    explicit ExceptionError(std::exception_ptr exception) noexcept
+        : exception_(std::move(exception)) {}
+
+    [[nodiscard]] const std::exception_ptr& exception() const noexcept {
+        return exception_;
+    }
+
+    [[noreturn]] void rethrow() const {
+        std::rethrow_exception(exception_);
+    }
+
+    // what() of a std::exception, a placeholder for anything else
+    [[nodiscard]] std::string message() const {
+        try {
+            rethrow();
+        } catch (const std::exception& e) {
+            return e.what();
+        } catch (...) {
+            return "unknown exception";
+        }
+    }
+
+ private:
+    std::exception_ptr exception_;
+};
+
+}  // namespace result
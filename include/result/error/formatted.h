@@ -0,0 +1,128 @@
+#pragma once
+
+#include "result/detail/describe_error.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+/**
+ * @brief Error formatted only when its message is asked for
+ *
+ * Stores the format string and a copy of the arguments, so that an error which is handled
+ * and dropped never pays for formatting:
+ * @code
+ * Result<Block, FormattedError<std::string, uint64_t>> read(const std::string& key, uint64_t at) {
+ *     ...
+ *     return makeError(FormattedError("no block {} at offset {}", key, at));
+ * }
+ * @endcode
+ * The format string is checked at compile time, like that of std::format.
+ */
+template <typename... Args>
+class FormattedError {
+ public:
+    explicit FormattedError(std::format_string<const Args&...> format, Args... args)
+        : format_(format.get()), args_(std::move(args)...) {}
+
+    [[nodiscard]] std::string message() const {
+        std::string out;
+        formatTo(std::back_inserter(out));
+        return out;
+    }
+
+    template <typename Out>
+    Out formatTo(Out out) const {
+        return std::apply(
+            [&](const Args&... args) {
+                return std::vformat_to(std::move(out), format_, std::make_format_args(args...));
+            },
+            args_);
+    }
+
+    [[nodiscard]] std::string_view format() const noexcept {
+        return format_;
+    }
+
+    [[nodiscard]] const std::tuple<Args...>& args() const noexcept {
+        return args_;
+    }
+
+ private:
+    std::string_view format_;
+    std::tuple<Args...> args_;
+};
+
+template <typename Format, typename... Args>
+FormattedError(Format, Args...) -> FormattedError<Args...>;
+
+/**
+ * @brief An error with context formatted only when the message is asked for
+ *
+ * The message is the context, then ": ", then the message of the cause, see withContext().
+ */
+template <typename E, typename... Args>
+class ContextError {
+ public:
+    ContextError(E cause, FormattedError<Args...> context)
+        : cause_(std::move(cause)), context_(std::move(context)) {}
+
+    [[nodiscard]] const E& cause() const noexcept {
+        return cause_;
+    }
+
+    [[nodiscard]] const FormattedError<Args...>& context() const noexcept {
+        return context_;
+    }
+
+    [[nodiscard]] std::string message() const {
+        std::string out;
+        formatTo(std::back_inserter(out));
+        return out;
+    }
+
+    template <typename Out>
+    Out formatTo(Out out) const {
+        out = context_.formatTo(std::move(out));
+        out = std::ranges::copy(std::string_view(": "), std::move(out)).out;
+        return detail::describeErrorTo(std::move(out), cause_);
+    }
+
+ private:
+    E cause_;
+    FormattedError<Args...> context_;
+};
+
+/**
+ * @brief Error mapper for mapErr wrapping every error into a ContextError
+ *
+ * Nothing is formatted until message() is called on the result:
+ * @code
+ * auto config = readFile(path) | mapErr(withContext("loading config {}", path));
+ * @endcode
+ */
+template <typename... Args>
+auto withContext(std::format_string<const std::decay_t<Args>&...> format, Args&&... args) {
+    using Context = FormattedError<std::decay_t<Args>...>;
+
+    return [context = Context(format, std::forward<Args>(args)...)]<typename E>(E&& error) {
+        using Error = ContextError<std::decay_t<E>, std::decay_t<Args>...>;
+        return Error(std::forward<E>(error), context);
+    };
+}
+
+}  // namespace result
+
+template <typename... Args>
+struct std::formatter<result::FormattedError<Args...>> : std::formatter<std::string_view> {
+    auto format(const result::FormattedError<Args...>& error, std::format_context& ctx) const {
+        return error.formatTo(ctx.out());
+    }
+};
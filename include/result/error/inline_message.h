@@ -0,0 +1,70 @@
+#pragma once
+
+#include "result/detail/min_sized_type.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+namespace result {
+
+/**
+ * @brief Error message stored inline, up to Capacity characters
+ *
+ * Longer messages are truncated rather than allocated, truncated() tells whether that happened.
+ * The type is trivially copyable and its size does not depend on the message.
+ */
+template <size_t Capacity>
+class InlineMessage {
+    using SizeType = detail::MinimalSizedIndexType<Capacity>;
+
+ public:
+    using value_type = char;  // NOLINT
+
+    constexpr InlineMessage() noexcept = default;
+
+    constexpr InlineMessage(std::string_view message) noexcept {  // NOLINT
+        append(message);
+    }
+
+    // Appends as much of `part` as fits
+    constexpr InlineMessage& append(std::string_view part) noexcept {
+        size_t n = std::min(part.size(), Capacity - size_);
+        std::copy_n(part.data(), n, data_ + size_);
+        size_ = static_cast<SizeType>(size_ + n);
+        truncated_ = truncated_ || n < part.size();
+        return *this;
+    }
+
+    // Lets std::back_inserter write into the message
+    constexpr void push_back(char c) noexcept {  // NOLINT
+        append(std::string_view(&c, 1));
+    }
+
+    [[nodiscard]] constexpr std::string_view message() const noexcept {
+        return {data_, size_};
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    [[nodiscard]] constexpr bool truncated() const noexcept {
+        return truncated_;
+    }
+
+    friend constexpr bool operator==(const InlineMessage& lhs, const InlineMessage& rhs) noexcept {
+        return lhs.message() == rhs.message();
+    }
+
+ private:
+    char data_[Capacity]{};
+    SizeType size_ = 0;
+    bool truncated_ = false;
+};
+
+}  // namespace result
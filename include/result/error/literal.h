@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace result {
+
+/**
+ * @brief Error carrying a string literal
+ *
+ * Only a pointer to the literal is stored, so the error is pointer-sized, trivially copyable
+ * and free to construct. Only constant expressions are accepted:
+ * @code
+ * Result<int, LiteralError> parse(std::string_view s) {
+ *     if (s.empty()) {
+ *         return makeError(LiteralError("empty input"));
+ *     }
+ *     ...
+ * }
+ * @endcode
+ */
+class LiteralError {
+ public:
+    template <size_t N>
+    consteval LiteralError(const char (&literal)[N]) noexcept  // NOLINT
+        : literal_(literal) {}
+
+    [[nodiscard]] constexpr std::string_view message() const noexcept {
+        return literal_;
+    }
+
+    [[nodiscard]] constexpr const char* c_str() const noexcept {  // NOLINT
+        return literal_;
+    }
+
+    // Compares contents: the same literal may have several addresses, and comparing
+    // addresses of distinct literals is not a constant expression
+    friend constexpr bool operator==(LiteralError lhs, LiteralError rhs) noexcept {
+        if !consteval {
+            if (lhs.literal_ == rhs.literal_) {
+                return true;
+            }
+        }
+        return lhs.message() == rhs.message();
+    }
+
+ private:
+    const char* literal_;
+};
+
+}  // namespace result
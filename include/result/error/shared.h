@@ -0,0 +1,123 @@
+#pragma once
+
+#include "result/relocate.h"
+#include "result/result.h"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+/**
+ * @brief Error wrapper making copies share one immutable E through an intrusive refcount
+ *
+ * When one upstream failure fans out to many waiters, copying a Result<V, Shared<E>> is an
+ * atomic increment instead of a deep copy of E:
+ * @code
+ * Result<Page, Shared<FetchError>> page = makeError(Shared(FetchError{url, status, body}));
+ * for (auto& waiter : waiters) {
+ *     waiter.resolve(page);  // no FetchError copied
+ * }
+ * @endcode
+ * Results convert between E and Shared<E>, and mapErr/orElse handlers see the E itself,
+ * see ErrorPayload. A moved-from Shared may only be destroyed or assigned to.
+ */
+template <typename E>
+class Shared {
+    static_assert(std::is_same_v<E, std::decay_t<E>>);
+
+ public:
+#if RESULT_LIBCPP_RELOCATION
+    // Lets libc++ containers relocate it with memcpy
+    using __trivially_relocatable = Shared;  // NOLINT
+#endif
+
+    explicit Shared(E error) : block_(new Block(std::move(error))) {}
+
+    template <typename... Args>
+    requires std::is_constructible_v<E, Args...>
+    explicit Shared(std::in_place_t, Args&&... args)
+        : block_(new Block(std::forward<Args>(args)...)) {}
+
+    Shared(const Shared& other) noexcept : block_(other.block_) {
+        if (block_ != nullptr) {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Shared(Shared&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {}
+
+    Shared& operator=(Shared other) noexcept {
+        std::swap(block_, other.block_);
+        return *this;
+    }
+
+    ~Shared() noexcept {
+        release();
+    }
+
+    [[nodiscard]] const E& get() const noexcept {
+        return block_->error;
+    }
+
+    const E& operator*() const noexcept {
+        return get();
+    }
+
+    const E* operator->() const noexcept {
+        return &get();
+    }
+
+    operator const E&() const noexcept {  // NOLINT
+        return get();
+    }
+
+    [[nodiscard]] decltype(auto) message() const
+    requires requires(const E& e) { e.message(); }
+    {
+        return get().message();
+    }
+
+    [[nodiscard]] size_t useCount() const noexcept {
+        return block_ != nullptr ? block_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+ private:
+    struct Block {
+        template <typename... Args>
+        explicit Block(Args&&... args) : error(std::forward<Args>(args)...) {}
+
+        std::atomic<size_t> refs{1};
+        E error;
+    };
+
+    void release() noexcept {
+        if (block_ == nullptr) {
+            return;
+        }
+
+        // The last owner skips the read-modify-write, as nobody else can be counting
+        if (block_->refs.load(std::memory_order_acquire) == 1 ||
+            block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete block_;
+        }
+    }
+
+    Block* block_;
+};
+
+template <typename E>
+struct ErrorPayload<Shared<E>> {
+    using type = E;
+
+    static const E& get(const Shared<E>& shared) noexcept {
+        return shared.get();
+    }
+};
+
+template <typename E>
+struct TriviallyRelocatable<Shared<E>> : std::true_type {};
+
+}  // namespace result
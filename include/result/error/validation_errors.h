@@ -0,0 +1,200 @@
+#pragma once
+
+#include "result/detail/min_sized_type.h"
+#include "result/detail/overloaded.h"
+#include "result/result.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+/**
+ * @brief Up to Capacity errors of types Es..., stored inline
+ *
+ * Errors past the capacity are counted rather than stored, overflow() tells how many.
+ * Each stored error is one of Es..., inspected with hasError<E>(), error<E>() and visit().
+ */
+template <size_t Capacity, typename... Es>
+class ValidationErrors {
+    static_assert(Capacity > 0);
+
+    using SizeType = detail::MinimalSizedIndexType<Capacity>;
+
+ public:
+    // One of Es...
+    class Error {
+     public:
+        template <typename E, typename... Args>
+        explicit Error(err_tag_t<E>, Args&&... args)
+            : error_(detail::pass_tag<E>, std::forward<Args>(args)...) {}
+
+        template <typename E>
+        requires tl::Contains<tl::List<Es...>, E>
+        [[nodiscard]] bool hasError() const noexcept {
+            return error_.template hasError<E>();
+        }
+
+        template <typename E>
+        requires tl::Contains<tl::List<Es...>, E>
+        [[nodiscard]] const E& error() const noexcept {
+            return error_.template error<E>();
+        }
+
+        // Calls f(error) with the stored error
+        template <typename F>
+        decltype(auto) visit(F&& f) const {
+            using First = std::tuple_element_t<0, std::tuple<Es...>>;
+            using Ret = decltype(f(std::declval<const First&>()));
+
+            return error_.taggedVisit(detail::Overloaded{
+                [](val_tag_t, const detail::Impossible&) -> Ret { std::unreachable(); },
+                [&](const auto& error) -> Ret { return f(error); },
+            });
+        }
+
+     private:
+        Result<detail::Impossible, Es...> error_;
+    };
+
+    ValidationErrors() noexcept = default;
+
+    ValidationErrors(const ValidationErrors& other) {
+        for (const Error& error : other) {
+            std::construct_at(data() + size_, error);
+            ++size_;
+        }
+        overflow_ = other.overflow_;
+    }
+
+    ValidationErrors(ValidationErrors&& other) noexcept {
+        for (Error& error : other) {
+            std::construct_at(data() + size_, std::move(error));
+            ++size_;
+        }
+        overflow_ = other.overflow_;
+    }
+
+    ValidationErrors& operator=(const ValidationErrors& other) {
+        if (this != &other) {
+            assign(other);
+        }
+        return *this;
+    }
+
+    ValidationErrors& operator=(ValidationErrors&& other) noexcept {
+        if (this != &other) {
+            assign(std::move(other));
+        }
+        return *this;
+    }
+
+    ~ValidationErrors() noexcept {
+        clear();
+    }
+
+    // Stores the error, or only counts it once the capacity is exhausted
+    template <typename E>
+    requires tl::Contains<tl::List<Es...>, std::decay_t<E>>
+    void add(E&& error) {
+        if (size_ == Capacity) {
+            ++overflow_;
+            return;
+        }
+
+        std::construct_at(data() + size_, err_tag<std::decay_t<E>>, std::forward<E>(error));
+        ++size_;
+    }
+
+    [[nodiscard]] std::span<const Error> errors() const noexcept {
+        return {data(), size_};
+    }
+
+    [[nodiscard]] const Error* begin() const noexcept {
+        return data();
+    }
+
+    [[nodiscard]] const Error* end() const noexcept {
+        return data() + size_;
+    }
+
+    [[nodiscard]] Error* begin() noexcept {
+        return data();
+    }
+
+    [[nodiscard]] Error* end() noexcept {
+        return data() + size_;
+    }
+
+    const Error& operator[](size_t i) const noexcept {
+        return data()[i];
+    }
+
+    // Number of stored errors
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+    // Number of errors dropped for lack of capacity
+    [[nodiscard]] size_t overflow() const noexcept {
+        return overflow_;
+    }
+
+    // Number of errors added
+    [[nodiscard]] size_t total() const noexcept {
+        return size_ + overflow_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return total() == 0;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Capacity;
+    }
+
+ private:
+    // Element by element, so a throwing copy leaves a valid prefix of `other`
+    template <typename Other>
+    void assign(Other&& other) {
+        const size_t common = std::min<size_t>(size_, other.size_);
+        for (size_t i = 0; i < common; ++i) {
+            data()[i] = std::forward_like<Other>(other.data()[i]);
+        }
+
+        std::destroy(data() + common, data() + size_);
+        size_ = static_cast<SizeType>(common);
+
+        for (size_t i = common; i < other.size_; ++i) {
+            std::construct_at(data() + i, std::forward_like<Other>(other.data()[i]));
+            ++size_;
+        }
+        overflow_ = other.overflow_;
+    }
+
+    void clear() noexcept {
+        std::destroy_n(data(), size_);
+        size_ = 0;
+        overflow_ = 0;
+    }
+
+    Error* data() noexcept {
+        return std::launder(reinterpret_cast<Error*>(storage_));  // NOLINT
+    }
+
+    const Error* data() const noexcept {
+        return std::launder(reinterpret_cast<const Error*>(storage_));  // NOLINT
+    }
+
+    alignas(Error) std::byte storage_[Capacity * sizeof(Error)];
+    SizeType size_ = 0;
+    size_t overflow_ = 0;
+};
+
+}  // namespace result
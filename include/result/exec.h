@@ -0,0 +1,5 @@
+#pragma once
+
+#include "result/exec/adaptors.h"
+#include "result/exec/just.h"
+#include "result/exec/sender.h"
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "result/detail/apply_to_template.h"
+#include "result/detail/overloaded.h"
+#include "result/exec/sender.h"
+#include "result/result.h"
+#include "result/traits.h"
+
+#include <type_list/list.h>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace result::exec {
+
+namespace detail {
+
+template <typename A>
+concept ResultArg = SomeResult<std::remove_cvref_t<A>>;
+
+// set_value_t(Result<V, Es...>) -> set_value_t(V), set_error_t(Es)...
+template <typename Sig>
+struct SplitSignature {
+    using type = completion_signatures<Sig>;
+};
+
+template <ResultArg A>
+struct SplitSignature<set_value_t(A)> {
+    template <typename V, typename... Es>
+    static auto split(Result<V, Es...>*) {
+        if constexpr (std::is_same_v<V, ::result::detail::Impossible>) {
+            return completion_signatures<set_error_t(Es)...>{};
+        } else if constexpr (std::is_same_v<V, Unit>) {
+            return completion_signatures<set_value_t(), set_error_t(Es)...>{};
+        } else {
+            return completion_signatures<set_value_t(V), set_error_t(Es)...>{};
+        }
+    }
+
+    using type = decltype(split(static_cast<std::remove_cvref_t<A>*>(nullptr)));
+};
+
+template <typename Sigs>
+struct SplitSignatures;
+
+template <typename... Sigs>
+struct SplitSignatures<completion_signatures<Sigs...>> {
+    using type = MergeSignatures<completion_signatures<>, typename SplitSignature<Sigs>::type...>;
+};
+
+// set_value_t(V), set_error_t(Es)... -> set_value_t(Result<V, Es...>)
+template <typename Sig>
+struct CollectSignature {
+    using Values = tl::List<>;
+    using Errors = tl::List<>;
+    using Others = completion_signatures<Sig>;
+};
+
+template <>
+struct CollectSignature<set_value_t()> {
+    using Values = tl::List<Unit>;
+    using Errors = tl::List<>;
+    using Others = completion_signatures<>;
+};
+
+template <typename A>
+struct CollectSignature<set_value_t(A)> {
+    using Values = tl::List<std::decay_t<A>>;
+    using Errors = tl::List<>;
+    using Others = completion_signatures<>;
+};
+
+template <typename E>
+struct CollectSignature<set_error_t(E)> {
+    using Values = tl::List<>;
+    using Errors = tl::List<std::decay_t<E>>;
+    using Others = completion_signatures<>;
+};
+
+template <typename Values>
+struct SingleValue {
+    static_assert(sizeof(Values) == 0, "toResult: the sender has several value completions");
+};
+
+// A sender that never completes with a value makes an error-only Result
+template <>
+struct SingleValue<tl::List<>> {
+    using type = ::result::detail::Impossible;
+};
+
+template <typename V>
+struct SingleValue<tl::List<V>> {
+    using type = V;
+};
+
+// Whether the Result with value V is made from the completion without throwing
+template <typename V, typename Sig>
+struct NothrowToResult : std::true_type {};
+
+template <typename V, typename... As>
+struct NothrowToResult<V, set_value_t(As...)>
+    : std::bool_constant<std::is_nothrow_constructible_v<V, As...>> {};
+
+template <typename V, typename E>
+struct NothrowToResult<V, set_error_t(E)>
+    : std::bool_constant<std::is_nothrow_constructible_v<std::decay_t<E>, E>> {};
+
+template <typename Sigs>
+struct CollectSignatures;
+
+template <typename... Sigs>
+struct CollectSignatures<completion_signatures<Sigs...>> {
+    using Value = typename SingleValue<
+        tl::Unique<tl::Concat<tl::List<>, typename CollectSignature<Sigs>::Values...>>>::type;
+    using Errors = tl::Unique<tl::Concat<tl::List<>, typename CollectSignature<Sigs>::Errors...>>;
+
+    using ResultType = ::result::detail::ApplyToTemplate<Result, tl::PushFront<Errors, Value>>;
+
+    // A throwing copy of a value or an error completes with set_error(std::exception_ptr)
+    using Throws = std::conditional_t<
+        (NothrowToResult<Value, Sigs>::value && ...),
+        completion_signatures<>,
+        completion_signatures<set_error_t(std::exception_ptr)>>;
+
+    using type = MergeSignatures<
+        completion_signatures<set_value_t(ResultType)>,
+        Throws,
+        typename CollectSignature<Sigs>::Others...>;
+};
+
+// set_value_t(R) -> set_value_t(decltype(c.pipe(R)))
+template <typename C, typename Sig>
+struct ThenSignature {
+    using type = completion_signatures<Sig>;
+};
+
+template <typename C, ResultArg A>
+struct ThenSignature<C, set_value_t(A)> {
+    using Out = decltype(std::declval<C>().pipe(std::declval<std::remove_cvref_t<A>>()));
+    using type = completion_signatures<set_value_t(Out)>;
+};
+
+template <typename C, typename Sigs>
+struct ThenSignatures;
+
+template <typename C, typename... Sigs>
+struct ThenSignatures<C, completion_signatures<Sigs...>> {
+    using type = MergeSignatures<completion_signatures<>, typename ThenSignature<C, Sigs>::type...>;
+};
+
+// Forwards the completions a wrapping receiver does not handle itself
+template <typename Derived>
+struct ForwardingReceiver {
+    using receiver_concept = receiver_t;  // NOLINT
+
+    template <typename E>
+    void set_error(this Derived&& self, E&& error) noexcept {  // NOLINT
+        std::move(self.out).set_error(std::forward<E>(error));
+    }
+
+    void set_stopped(this Derived&& self) noexcept {  // NOLINT
+        std::move(self.out).set_stopped();
+    }
+};
+
+template <Receiver R>
+struct SplitErrorsReceiver : ForwardingReceiver<SplitErrorsReceiver<R>> {
+    R out;
+
+    explicit SplitErrorsReceiver(R r) : out(std::move(r)) {}
+
+    template <typename... As>
+    void set_value(As&&... values) && noexcept {  // NOLINT
+        std::move(out).set_value(std::forward<As>(values)...);
+    }
+
+    // Dispatches on the index of the Result, with no allocation and no exception_ptr
+    template <ResultArg A>
+    void set_value(A&& r) && noexcept {  // NOLINT
+        using V = ValueTypeOf<std::remove_cvref_t<A>>;
+
+        std::forward<A>(r).taggedVisit(::result::detail::Overloaded{
+            [&]<typename T>(val_tag_t, T&& value) {
+                if constexpr (std::is_same_v<V, Unit>) {
+                    std::move(out).set_value();
+                } else if constexpr (!std::is_same_v<V, ::result::detail::Impossible>) {
+                    std::move(out).set_value(std::forward<T>(value));
+                }
+            },
+            [&]<typename E>(E&& error) { std::move(out).set_error(std::forward<E>(error)); },
+        });
+    }
+};
+
+template <typename ResultType, Receiver R>
+struct ToResultReceiver {
+    using receiver_concept = receiver_t;  // NOLINT
+
+    R out;
+
+    template <typename... As>
+    void set_value(As&&... values) && noexcept {  // NOLINT
+        using V = ValueTypeOf<ResultType>;
+
+        std::move(*this).template complete<std::is_nothrow_constructible_v<V, As...>>(
+            [&] { return ResultType(std::in_place, std::forward<As>(values)...); });
+    }
+
+    template <typename E>
+    void set_error(E&& error) && noexcept {  // NOLINT
+        using G = std::decay_t<E>;
+
+        std::move(*this).template complete<std::is_nothrow_constructible_v<G, E>>(
+            [&] { return ResultType(err_tag<G>, std::forward<E>(error)); });
+    }
+
+    void set_stopped() && noexcept {  // NOLINT
+        std::move(out).set_stopped();
+    }
+
+    // Completes with the Result made by `make`, or with the exception it throws
+    template <bool Nothrow, typename Make>
+    void complete(Make make) && noexcept {
+        if constexpr (Nothrow) {
+            std::move(out).set_value(make());
+        } else {
+            try {
+                std::move(out).set_value(make());
+            } catch (...) {
+                std::move(out).set_error(std::current_exception());
+            }
+        }
+    }
+};
+
+template <typename C, Receiver R>
+struct ThenReceiver : ForwardingReceiver<ThenReceiver<C, R>> {
+    C combinator;
+    R out;
+
+    ThenReceiver(C c, R r) : combinator(std::move(c)), out(std::move(r)) {}
+
+    template <typename... As>
+    void set_value(As&&... values) && noexcept {  // NOLINT
+        std::move(out).set_value(std::forward<As>(values)...);
+    }
+
+    template <ResultArg A>
+    void set_value(A&& r) && noexcept {  // NOLINT
+        std::move(out).set_value(std::move(combinator).pipe(std::forward<A>(r)));
+    }
+};
+
+// Sender adaptor: connects the wrapped sender to the receiver made by MakeReceiver
+template <Sender S, typename Sigs, typename MakeReceiver>
+class AdaptedSender {
+ public:
+    using sender_concept = sender_t;     // NOLINT
+    using completion_signatures = Sigs;  // NOLINT
+
+    AdaptedSender(S sender, MakeReceiver make)
+        : sender_(std::move(sender)), make_(std::move(make)) {}
+
+    template <typename Self, ReceiverOf<Sigs> R>
+    auto connect(this Self&& self, R&& receiver) {
+        return std::forward_like<Self>(self.sender_)
+            .connect(std::forward_like<Self>(self.make_)(std::forward<R>(receiver)));
+    }
+
+ private:
+    S sender_;
+    MakeReceiver make_;
+};
+
+template <typename F>
+struct Closure {
+    F adapt;
+
+    template <Sender S>
+    friend auto operator|(S&& sender, Closure closure) {
+        return std::move(closure.adapt)(std::forward<S>(sender));
+    }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Turns a sender of Result<V, Es...> into one completing with set_value(V)
+ * and set_error(E) for each E in Es
+ *
+ * Result<Unit, Es...> completes with set_value(). Other completions are forwarded as is:
+ * @code
+ * auto s = readBlock(fd) | splitErrors();  // set_value(Block), set_error(IoError), ...
+ * @endcode
+ */
+template <Sender S>
+auto splitErrors(S&& sender) {
+    using Sigs = typename detail::SplitSignatures<CompletionSignaturesOf<S>>::type;
+
+    auto make = []<Receiver R>(R&& receiver) {
+        return detail::SplitErrorsReceiver<std::remove_cvref_t<R>>(std::forward<R>(receiver));
+    };
+    return detail::AdaptedSender<std::remove_cvref_t<S>, Sigs, decltype(make)>(
+        std::forward<S>(sender), make);
+}
+
+inline auto splitErrors() {
+    auto adapt = []<Sender S>(S&& sender) { return splitErrors(std::forward<S>(sender)); };
+    return detail::Closure<decltype(adapt)>{adapt};
+}
+
+/**
+ * @brief The reverse of splitErrors(): turns a sender completing with set_value(V) and
+ * set_error(Es)... into one completing with set_value(Result<V, Es...>)
+ *
+ * set_value() becomes a Result<Unit, Es...>, set_stopped is forwarded as is.
+ */
+template <Sender S>
+auto toResult(S&& sender) {
+    using Collect = detail::CollectSignatures<CompletionSignaturesOf<S>>;
+    using ResultType = typename Collect::ResultType;
+
+    auto make = []<Receiver R>(R&& receiver) {
+        return detail::ToResultReceiver<ResultType, std::remove_cvref_t<R>>{
+            std::forward<R>(receiver)};
+    };
+    return detail::AdaptedSender<std::remove_cvref_t<S>, typename Collect::type, decltype(make)>(
+        std::forward<S>(sender), make);
+}
+
+inline auto toResult() {
+    auto adapt = []<Sender S>(S&& sender) { return toResult(std::forward<S>(sender)); };
+    return detail::Closure<decltype(adapt)>{adapt};
+}
+
+/**
+ * @brief Applies a pipe combinator to the Result a sender completes with
+ *
+ * Same semantics as `r | c` for a Result r:
+ * @code
+ * auto s = fetch(key) | then(andThen(parse)) | then(map(render));
+ * @endcode
+ */
+template <Sender S, typename C>
+auto then(S&& sender, C combinator) {
+    using Sigs = typename detail::ThenSignatures<C, CompletionSignaturesOf<S>>::type;
+
+    auto make = [c = std::move(combinator)]<Receiver R>(this auto&& self, R&& receiver) {
+        return detail::ThenReceiver<C, std::remove_cvref_t<R>>(
+            std::forward_like<decltype(self)>(c), std::forward<R>(receiver));
+    };
+    return detail::AdaptedSender<std::remove_cvref_t<S>, Sigs, decltype(make)>(
+        std::forward<S>(sender), std::move(make));
+}
+
+template <typename C>
+auto then(C combinator) {
+    auto adapt = [c = std::move(combinator)]<Sender S>(this auto&& self, S&& sender) {
+        return then(std::forward<S>(sender), std::forward_like<decltype(self)>(c));
+    };
+    return detail::Closure<decltype(adapt)>{std::move(adapt)};
+}
+
+}  // namespace result::exec
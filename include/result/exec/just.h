@@ -0,0 +1,65 @@
+#pragma once
+
+#include "result/exec/sender.h"
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result::exec {
+
+// Completes with Tag and the stored arguments as soon as started
+template <typename Tag, typename... Vs>
+class JustSender {
+ public:
+    using sender_concept = sender_t;  // NOLINT
+    using completion_signatures = exec::completion_signatures<Tag(Vs...)>;  // NOLINT
+
+    explicit JustSender(Vs... values) : values_(std::move(values)...) {}
+
+    template <Receiver R>
+    struct Operation {
+        using operation_state_concept = operation_state_t;  // NOLINT
+
+        std::tuple<Vs...> values;
+        R receiver;
+
+        void start() & noexcept {
+            std::apply(
+                [&](Vs&... vs) {
+                    if constexpr (std::is_same_v<Tag, set_value_t>) {
+                        std::move(receiver).set_value(std::move(vs)...);
+                    } else if constexpr (std::is_same_v<Tag, set_error_t>) {
+                        std::move(receiver).set_error(std::move(vs)...);
+                    } else {
+                        std::move(receiver).set_stopped();
+                    }
+                },
+                values);
+        }
+    };
+
+    template <typename Self, ReceiverOf<completion_signatures> R>
+    Operation<std::remove_cvref_t<R>> connect(this Self&& self, R&& receiver) {
+        return {std::forward_like<Self>(self.values_), std::forward<R>(receiver)};
+    }
+
+ private:
+    std::tuple<Vs...> values_;
+};
+
+template <typename... Vs>
+JustSender<set_value_t, std::decay_t<Vs>...> just(Vs&&... values) {
+    return JustSender<set_value_t, std::decay_t<Vs>...>(std::forward<Vs>(values)...);
+}
+
+template <typename E>
+JustSender<set_error_t, std::decay_t<E>> justError(E&& error) {
+    return JustSender<set_error_t, std::decay_t<E>>(std::forward<E>(error));
+}
+
+inline JustSender<set_stopped_t> justStopped() {
+    return JustSender<set_stopped_t>();
+}
+
+}  // namespace result::exec
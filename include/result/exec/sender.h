@@ -0,0 +1,134 @@
+#pragma once
+
+#include <type_list/list.h>
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include <version>
+
+// Whether the protocol is that of the standard library, so that the adaptors work with
+// any std::execution sender and receiver
+#ifndef RESULT_STD_EXECUTION
+#if defined(__cpp_lib_senders)
+#define RESULT_STD_EXECUTION 1
+#else
+#define RESULT_STD_EXECUTION 0
+#endif
+#endif
+
+#if RESULT_STD_EXECUTION
+#include <execution>
+#endif
+
+namespace result::exec {
+
+// The sender/receiver protocol of std::execution (P2300): a sender declares its
+// completion_signatures and is connected to a receiver, which yields an operation state;
+// start() on the operation state completes the receiver with exactly one of set_value,
+// set_error or set_stopped. Until the standard library ships it, a minimal one of the same
+// shape stands in, see RESULT_STD_EXECUTION.
+
+#if RESULT_STD_EXECUTION
+
+using std::execution::completion_signatures;
+using std::execution::operation_state_t;
+using std::execution::receiver_t;
+using std::execution::sender_t;
+using std::execution::set_error_t;
+using std::execution::set_stopped_t;
+using std::execution::set_value_t;
+
+template <typename S>
+concept Sender = std::execution::sender<S>;
+
+template <typename R>
+concept Receiver = std::execution::receiver<R>;
+
+template <Sender S>
+using CompletionSignaturesOf = std::execution::completion_signatures_of_t<S>;
+
+#else
+
+struct sender_t {};           // NOLINT
+struct receiver_t {};         // NOLINT
+struct operation_state_t {};  // NOLINT
+
+// Completion tags, the return types of completion signatures such as set_error_t(IoError)
+struct set_value_t {};    // NOLINT
+struct set_error_t {};    // NOLINT
+struct set_stopped_t {};  // NOLINT
+
+template <typename... Sigs>
+struct completion_signatures {};  // NOLINT
+
+template <typename S>
+concept Sender =
+    std::derived_from<typename std::remove_cvref_t<S>::sender_concept, sender_t> &&
+    requires { typename std::remove_cvref_t<S>::completion_signatures; };
+
+template <typename R>
+concept Receiver =
+    std::derived_from<typename std::remove_cvref_t<R>::receiver_concept, receiver_t> &&
+    std::move_constructible<std::remove_cvref_t<R>>;
+
+template <Sender S>
+using CompletionSignaturesOf = typename std::remove_cvref_t<S>::completion_signatures;
+
+#endif
+
+namespace detail {
+
+template <typename R, typename Sig>
+struct AcceptsCompletion : std::false_type {};
+
+template <typename R, typename... As>
+struct AcceptsCompletion<R, set_value_t(As...)>
+    : std::bool_constant<requires(R&& r, As&&... as) {
+          std::move(r).set_value(std::forward<As>(as)...);
+      }> {};
+
+template <typename R, typename E>
+struct AcceptsCompletion<R, set_error_t(E)>
+    : std::bool_constant<requires(R&& r, E&& e) { std::move(r).set_error(std::forward<E>(e)); }> {
+};
+
+template <typename R>
+struct AcceptsCompletion<R, set_stopped_t()>
+    : std::bool_constant<requires(R&& r) { std::move(r).set_stopped(); }> {};
+
+template <typename R, typename Sigs>
+struct AcceptsAll;
+
+template <typename R, typename... Sigs>
+struct AcceptsAll<R, completion_signatures<Sigs...>>
+    : std::bool_constant<(AcceptsCompletion<R, Sigs>::value && ...)> {};
+
+template <typename Sigs>
+struct SignatureList;
+
+template <typename... Sigs>
+struct SignatureList<completion_signatures<Sigs...>> {
+    using type = tl::List<Sigs...>;
+};
+
+template <typename List>
+struct FromSignatureList;
+
+template <typename... Sigs>
+struct FromSignatureList<tl::List<Sigs...>> {
+    using type = completion_signatures<Sigs...>;
+};
+
+}  // namespace detail
+
+// A receiver accepting every completion in Sigs
+template <typename R, typename Sigs>
+concept ReceiverOf = Receiver<R> && detail::AcceptsAll<std::remove_cvref_t<R>, Sigs>::value;
+
+// completion_signatures with the signatures of the given lists, each listed once
+template <typename... SigLists>
+using MergeSignatures = typename detail::FromSignatureList<
+    tl::Unique<tl::Concat<typename detail::SignatureList<SigLists>::type...>>>::type;
+
+}  // namespace result::exec
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "result/result.h"
+#include "result/traits.h"
+#include "result/union.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+// Error of a Future whose Promise was destroyed without a result
+struct BrokenPromise {
+    bool operator==(const BrokenPromise&) const = default;
+};
+
+template <SomeResult R>
+class Promise;
+
+template <SomeResult R>
+class Future;
+
+namespace detail {
+
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief The only allocation shared by a Promise and its Future
+ *
+ * Holds the result, an inline continuation and a single status word. The producer publishes
+ * the result with one exchange on the status, which also tells it whether a consumer
+ * is sleeping on the word or has left a continuation to run.
+ */
+template <SomeResult R>
+class FutureState {
+ public:
+    using Output = Union<ValueTypeOf<R>, R, BrokenPromise>;
+
+    static constexpr size_t CallbackCapacity = 4 * sizeof(void*);
+    static constexpr int SpinCount = 1 << 10;
+
+    // Pinned
+    FutureState(FutureState&&) = delete;
+    FutureState(FutureState const&) = delete;
+    FutureState& operator=(FutureState const&) = delete;
+    FutureState& operator=(FutureState&&) = delete;
+
+    void retain() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            destroy_(this);
+        }
+    }
+
+    template <typename... Args>
+    void fulfill(Args&&... args) {
+        std::construct_at(&output_, std::forward<Args>(args)...);
+
+        switch (status_.exchange(Ready, std::memory_order_acq_rel)) {
+            case Waiting:
+                status_.notify_one();
+                break;
+            case Callback:
+                callback_(*this);
+                break;
+            default:
+                break;
+        }
+    }
+
+    [[nodiscard]] bool isReady() const noexcept {
+        return status_.load(std::memory_order_acquire) == Ready;
+    }
+
+    // Spins for a while, then sleeps on the status word until the result is published
+    void wait() noexcept {
+        for (int i = 0; i < SpinCount; ++i) {
+            if (isReady()) {
+                return;
+            }
+            cpuRelax();
+        }
+
+        uint32_t status = Empty;
+        if (status_.compare_exchange_strong(status, Waiting, std::memory_order_acquire)) {
+            status = Waiting;
+        }
+        while (status != Ready) {
+            status_.wait(status, std::memory_order_acquire);
+            status = status_.load(std::memory_order_acquire);
+        }
+    }
+
+    Output& output() noexcept {
+        return output_;
+    }
+
+    // Runs `f` on the thread publishing the result, or right away if it is already there.
+    // Takes over the reference of the consumer.
+    template <typename F>
+    void setCallback(F&& f) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= CallbackCapacity && alignof(Fn) <= alignof(std::max_align_t),
+                      "Continuation does not fit into the future state");
+
+        ::new (static_cast<void*>(callback_storage_)) Fn(std::forward<F>(f));
+        callback_ = [](FutureState& self) {
+            Fn& fn = *std::launder(reinterpret_cast<Fn*>(self.callback_storage_));  // NOLINT
+            std::invoke(std::move(fn), std::move(self.output_));
+            fn.~Fn();
+            self.release();
+        };
+
+        uint32_t status = Empty;
+        if (!status_.compare_exchange_strong(status,
+                                             Callback,
+                                             std::memory_order_release,
+                                             std::memory_order_acquire)) {
+            callback_(*this);
+        }
+    }
+
+ protected:
+    using Destroy = void (*)(FutureState*) noexcept;
+
+    explicit FutureState(Destroy destroy) noexcept : destroy_(destroy) {}
+
+    ~FutureState() noexcept {
+        if (status_.load(std::memory_order_relaxed) == Ready) {
+            std::destroy_at(&output_);
+        }
+    }
+
+ private:
+    enum Status : uint32_t {
+        Empty,
+        Waiting,   // the consumer sleeps on the status word
+        Callback,  // the consumer left a continuation
+        Ready,
+    };
+
+    std::atomic<uint32_t> status_{Empty};
+    std::atomic<uint32_t> refs_{1};
+    Destroy destroy_;
+    void (*callback_)(FutureState&) = nullptr;
+
+    union {
+        Output output_;
+    };
+
+    alignas(std::max_align_t) std::byte callback_storage_[CallbackCapacity];
+};
+
+// Future state allocated with, and freed by, a copy of Alloc
+template <SomeResult R, typename Alloc>
+class AllocatedFutureState final : public FutureState<R> {
+    using Traits = std::allocator_traits<Alloc>::template rebind_traits<AllocatedFutureState>;
+    using Allocator = typename Traits::allocator_type;
+
+ public:
+    static FutureState<R>* make(const Alloc& alloc) {
+        Allocator allocator(alloc);
+        AllocatedFutureState* self = Traits::allocate(allocator, 1);
+        return std::construct_at(self, allocator);
+    }
+
+    explicit AllocatedFutureState(const Allocator& alloc) noexcept
+        : FutureState<R>(&destroy), alloc_(alloc) {}
+
+ private:
+    static void destroy(FutureState<R>* state) noexcept {
+        auto* self = static_cast<AllocatedFutureState*>(state);
+        Allocator alloc = std::move(self->alloc_);
+        std::destroy_at(self);
+        Traits::deallocate(alloc, self, 1);
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Producing end of a one-shot channel for a Result
+ *
+ * A lightweight replacement for std::promise<R>: one allocation for the shared state,
+ * optionally from a caller-supplied allocator (e.g. a pool), no mutex and no exception_ptr.
+ * @code
+ * Promise<Result<int, IoError>> promise;
+ * Future<Result<int, IoError>> future = promise.getFuture();
+ * pool.submit([p = std::move(promise)] mutable { p.setResult(read()); });
+ * Result<int, IoError, BrokenPromise> r = std::move(future).get();
+ * @endcode
+ * A Promise destroyed without a result completes its future with BrokenPromise.
+ */
+template <SomeResult R>
+class Promise {
+    using State = detail::FutureState<R>;
+
+ public:
+    using Output = typename State::Output;
+
+    Promise() : Promise(std::allocator_arg, std::allocator<std::byte>()) {}
+
+    template <typename Alloc>
+    Promise(std::allocator_arg_t, const Alloc& alloc)
+        : state_(detail::AllocatedFutureState<R, Alloc>::make(alloc)) {}
+
+    Promise(Promise&& other) noexcept
+        : state_(std::exchange(other.state_, nullptr)),
+          fulfilled_(std::exchange(other.fulfilled_, true)) {}
+
+    Promise& operator=(Promise&& other) noexcept {
+        if (this != &other) {
+            reset();
+            state_ = std::exchange(other.state_, nullptr);
+            fulfilled_ = std::exchange(other.fulfilled_, true);
+        }
+        return *this;
+    }
+
+    Promise(Promise const&) = delete;
+    Promise& operator=(Promise const&) = delete;
+
+    ~Promise() noexcept {
+        reset();
+    }
+
+    // Must be called at most once
+    [[nodiscard]] Future<R> getFuture() {
+        state_->retain();
+        return Future<R>(state_);
+    }
+
+    // Publishes the result and runs the continuation, if any. Must be called at most once.
+    template <typename U>
+    requires std::is_constructible_v<Output, U>
+    void setResult(U&& x) {
+        fulfilled_ = true;
+        state_->fulfill(std::forward<U>(x));
+    }
+
+ private:
+    void reset() noexcept {
+        if (state_ == nullptr) {
+            return;
+        }
+        if (!fulfilled_) {
+            state_->fulfill(makeError(BrokenPromise{}));
+        }
+        std::exchange(state_, nullptr)->release();
+    }
+
+    State* state_;
+    bool fulfilled_ = false;
+};
+
+// Consuming end of a one-shot channel for a Result, see Promise
+template <SomeResult R>
+class Future {
+    using State = detail::FutureState<R>;
+
+ public:
+    using Output = typename State::Output;
+
+    Future() = default;
+
+    Future(Future&& other) noexcept : state_(std::exchange(other.state_, nullptr)) {}
+
+    Future& operator=(Future&& other) noexcept {
+        if (this != &other) {
+            reset();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    Future(Future const&) = delete;
+    Future& operator=(Future const&) = delete;
+
+    ~Future() noexcept {
+        reset();
+    }
+
+    [[nodiscard]] bool valid() const noexcept {
+        return state_ != nullptr;
+    }
+
+    [[nodiscard]] bool isReady() const noexcept {
+        return state_->isReady();
+    }
+
+    void wait() const noexcept {
+        state_->wait();
+    }
+
+    // Blocks until the result is published and moves it out
+    [[nodiscard]] Output get() && {
+        state_->wait();
+        Output out = std::move(state_->output());
+        reset();
+        return out;
+    }
+
+    /**
+     * @brief Calls `f(Output&&)` once the result is published
+     *
+     * The continuation runs on the thread calling Promise::setResult, or on the calling thread
+     * if the result is already there. It is stored inside the shared state, so it must fit
+     * into detail::FutureState<R>::CallbackCapacity bytes.
+     */
+    template <typename F>
+    requires std::is_invocable_v<std::decay_t<F>, Output&&>
+    void then(F&& f) && {
+        std::exchange(state_, nullptr)->setCallback(std::forward<F>(f));
+    }
+
+ private:
+    friend class Promise<R>;
+
+    explicit Future(State* state) noexcept : state_(state) {}
+
+    void reset() noexcept {
+        if (state_ != nullptr) {
+            std::exchange(state_, nullptr)->release();
+        }
+    }
+
+    State* state_ = nullptr;
+};
+
+}  // namespace result
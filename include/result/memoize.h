@@ -0,0 +1,309 @@
+#pragma once
+
+#include "result/detail/callable_args.h"
+#include "result/result.h"
+#include "result/traits.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace result {
+
+/**
+ * @brief What memoize() keeps and for how long
+ *
+ * Values are always cached, errors only if their type is listed in CachedErrors,
+ * so that e.g. NotFound is remembered while Transient is retried on every call:
+ * @code
+ * auto lookup = memoize(fetchUser, MemoizePolicy<NotFound>{
+ *     .capacity = 1 << 16,
+ *     .ttl = std::chrono::minutes(5),
+ *     .error_ttl = std::chrono::seconds(10),
+ * });
+ * @endcode
+ */
+template <typename... CachedErrors>
+struct MemoizePolicy {
+    using Clock = std::chrono::steady_clock;
+
+    // Maximal number of cached entries, rounded up to a power of two
+    size_t capacity = 4096;
+    Clock::duration ttl = Clock::duration::max();
+    // Lifetime of cached errors, defaults to ttl
+    std::optional<Clock::duration> error_ttl = std::nullopt;
+
+    template <SomeResult R>
+    [[nodiscard]] static bool caches(const R& r) noexcept {
+        return r.hasValue() || (r.template hasError<CachedErrors>() || ...);
+    }
+};
+
+struct MemoizeStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    // Misses whose result was not cacheable under the policy
+    uint64_t bypasses = 0;
+
+    [[nodiscard]] double hitRate() const noexcept {
+        const uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+namespace detail {
+
+inline uint64_t mixHash(uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief Bounded concurrent hash table of memoized Results
+ *
+ * Open addressing with probing limited to a group of Ways adjacent slots: a key lives
+ * in the group its hash selects, and inserting into a full group evicts the expired or
+ * the least recently used entry of that group, which bounds the memory by the capacity.
+ * Groups are spread over independently locked shards on separate cache lines.
+ */
+template <typename Key, SomeResult R, typename Policy>
+class MemoTable {
+ public:
+    using Clock = typename Policy::Clock;
+    using TimePoint = typename Clock::time_point;
+    using Duration = typename Clock::duration;
+
+    static constexpr size_t Ways = 8;
+    static constexpr size_t MaxShards = 64;
+
+    explicit MemoTable(const Policy& policy)
+        : ttl_(policy.ttl), error_ttl_(policy.error_ttl.value_or(policy.ttl)) {
+        const size_t groups = std::bit_ceil(std::max(policy.capacity, Ways)) / Ways;
+        num_shards_ = std::min(groups, MaxShards);
+        groups_per_shard_ = groups / num_shards_;
+
+        shards_ = std::make_unique<Shard[]>(num_shards_);
+        for (size_t i = 0; i < num_shards_; ++i) {
+            shards_[i].slots.resize(groups_per_shard_ * Ways);
+        }
+    }
+
+    template <typename... Args>
+    std::optional<R> find(uint64_t hash, TimePoint now, const Args&... args) {
+        Shard& shard = shardOf(hash);
+        std::lock_guard lock(shard.mutex);
+
+        for (Slot& slot : groupOf(shard, hash)) {
+            if (slot.entry.has_value() && slot.hash == hash &&
+                slot.entry->key == std::forward_as_tuple(args...)) {
+                if (now < slot.entry->expires) {
+                    slot.last_use = ++shard.tick;
+                    shard.hits.fetch_add(1, std::memory_order_relaxed);
+                    return slot.entry->result;
+                }
+
+                slot.entry.reset();
+                break;
+            }
+        }
+
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    void insert(uint64_t hash, TimePoint now, Key key, const R& r) {
+        Shard& shard = shardOf(hash);
+        if (!Policy::caches(r)) {
+            shard.bypasses.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const auto expires = expiry(now, r.hasValue() ? ttl_ : error_ttl_);
+        std::lock_guard lock(shard.mutex);
+
+        auto group = groupOf(shard, hash);
+        Slot* victim = &group.front();
+        for (Slot& slot : group) {
+            if (slot.entry.has_value() && slot.hash == hash && slot.entry->key == key) {
+                victim = &slot;
+                break;
+            }
+            if (rank(slot, now) < rank(*victim, now)) {
+                victim = &slot;
+            }
+        }
+
+        victim->entry.emplace(std::move(key), r, expires);
+        victim->hash = hash;
+        victim->last_use = ++shard.tick;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < num_shards_; ++i) {
+            std::lock_guard lock(shards_[i].mutex);
+            for (Slot& slot : shards_[i].slots) {
+                slot.entry.reset();
+            }
+        }
+    }
+
+    [[nodiscard]] MemoizeStats stats() const noexcept {
+        MemoizeStats stats;
+        for (size_t i = 0; i < num_shards_; ++i) {
+            stats.hits += shards_[i].hits.load(std::memory_order_relaxed);
+            stats.misses += shards_[i].misses.load(std::memory_order_relaxed);
+            stats.bypasses += shards_[i].bypasses.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return num_shards_ * groups_per_shard_ * Ways;
+    }
+
+ private:
+    struct Entry {
+        Key key;
+        R result;
+        TimePoint expires;
+    };
+
+    struct Slot {
+        std::optional<Entry> entry;
+        uint64_t hash = 0;
+        uint64_t last_use = 0;
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::vector<Slot> slots;
+        uint64_t tick = 0;
+
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> bypasses{0};
+    };
+
+    static TimePoint expiry(TimePoint now, Duration ttl) noexcept {
+        return ttl >= TimePoint::max() - now ? TimePoint::max() : now + ttl;
+    }
+
+    // Eviction order: empty, expired, then the least recently used
+    static uint64_t rank(const Slot& slot, TimePoint now) noexcept {
+        if (!slot.entry.has_value()) {
+            return 0;
+        }
+        if (!(now < slot.entry->expires)) {
+            return 1;
+        }
+        return 2 + slot.last_use;
+    }
+
+    Shard& shardOf(uint64_t hash) noexcept {
+        return shards_[hash & (num_shards_ - 1)];
+    }
+
+    std::span<Slot> groupOf(Shard& shard, uint64_t hash) noexcept {
+        const size_t group = (hash / num_shards_) & (groups_per_shard_ - 1);
+        return std::span<Slot>(shard.slots).subspan(group * Ways, Ways);
+    }
+
+    Duration ttl_;
+    Duration error_ttl_;
+
+    size_t num_shards_ = 0;
+    size_t groups_per_shard_ = 0;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace detail
+
+template <typename F, typename Policy, typename Args = detail::CallableArgs<F>>
+class Memoized;
+
+/**
+ * @brief Result-returning function with a shared cache of its results
+ *
+ * Copies share the cache, so the wrapper can be passed into pipes by value:
+ * @code
+ * auto user = parseId(request) | andThen(lookup);
+ * @endcode
+ * Concurrent misses on the same key may both call the function, the later result wins.
+ */
+template <typename F, typename Policy, typename... Args>
+class Memoized<F, Policy, tl::List<Args...>> {
+ public:
+    using Key = std::tuple<std::decay_t<Args>...>;
+    using ResultType = std::invoke_result_t<const F&, const std::decay_t<Args>&...>;
+
+    static_assert(SomeResult<ResultType>, "memoize() expects a function returning Result");
+
+    Memoized(F f, const Policy& policy)
+        : state_(std::make_shared<State>(std::move(f), policy)) {}
+
+    ResultType operator()(const std::decay_t<Args>&... args) const {
+        using Clock = typename Policy::Clock;
+
+        const uint64_t hash = hashOf(args...);
+        const auto now = Clock::now();
+
+        if (auto cached = state_->table.find(hash, now, args...)) {
+            return std::move(*cached);
+        }
+
+        ResultType r = std::invoke(state_->f, args...);
+        state_->table.insert(hash, now, Key(args...), r);
+        return r;
+    }
+
+    [[nodiscard]] MemoizeStats stats() const noexcept {
+        return state_->table.stats();
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return state_->table.capacity();
+    }
+
+    void clear() {
+        state_->table.clear();
+    }
+
+ private:
+    struct State {
+        State(F f, const Policy& policy) : f(std::move(f)), table(policy) {}
+
+        F f;
+        detail::MemoTable<Key, ResultType, Policy> table;
+    };
+
+    static uint64_t hashOf(const std::decay_t<Args>&... args) noexcept {
+        uint64_t hash = 0x9e3779b97f4a7c15ULL;
+        ((hash = detail::mixHash(hash ^ std::hash<std::decay_t<Args>>{}(args))), ...);
+        return hash;
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+// (Args... -> Result<T, Es...>) -> (Args... -> Result<T, Es...>) with a cache
+template <typename F, typename Policy = MemoizePolicy<>>
+auto memoize(F f, const Policy& policy = {}) {
+    return Memoized<F, Policy>(std::move(f), policy);
+}
+
+}  // namespace result
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "result/combine/instrumented.h"
+#include "result/metrics/histogram.h"
+#include "result/metrics/stage.h"
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace result {
+
+namespace detail {
+
+/**
+ * @brief Log-linear bucketing of 64-bit samples
+ *
+ * Every power of two is split into SubCount equal buckets, so a bucket is never wider
+ * than 1/SubCount of its lower bound. Samples of 2^MaxBits and more share the last bucket.
+ */
+struct LogLinearBuckets {
+    static constexpr unsigned SubBits = 4;
+    static constexpr unsigned SubCount = 1U << SubBits;
+    static constexpr unsigned MaxBits = 40;  // about 18 minutes in nanoseconds
+    static constexpr size_t Count = (MaxBits - SubBits + 1) * SubCount;
+
+    static constexpr size_t index(uint64_t sample) noexcept {
+        if (sample < SubCount) {
+            return static_cast<size_t>(sample);
+        }
+
+        const auto msb = static_cast<unsigned>(std::bit_width(sample)) - 1;
+        if (msb >= MaxBits) {
+            return Count - 1;
+        }
+
+        const unsigned shift = msb - SubBits;
+        return (shift + 1) * SubCount + ((sample >> shift) & (SubCount - 1));
+    }
+
+    static constexpr uint64_t lowerBound(size_t index) noexcept {
+        if (index < SubCount) {
+            return index;
+        }
+
+        const size_t shift = index / SubCount - 1;
+        return (SubCount + index % SubCount) << shift;
+    }
+
+    static constexpr uint64_t upperBound(size_t index) noexcept {
+        return index + 1 == Count ? UINT64_MAX : lowerBound(index + 1) - 1;
+    }
+};
+
+// Stable per-thread number used to pick a shard
+inline size_t threadShard() noexcept {
+    static std::atomic<size_t> next{0};
+    thread_local const size_t shard = next.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+}  // namespace detail
+
+// Point-in-time copy of a LatencyHistogram, snapshots of different histograms can be merged
+class HistogramSnapshot {
+    using Buckets = detail::LogLinearBuckets;
+
+ public:
+    void add(size_t bucket, uint64_t count) noexcept {
+        counts_[bucket] += count;
+        count_ += count;
+    }
+
+    void addSum(uint64_t sum) noexcept {
+        sum_ += sum;
+    }
+
+    HistogramSnapshot& merge(const HistogramSnapshot& other) noexcept {
+        for (size_t i = 0; i < Buckets::Count; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        count_ += other.count_;
+        sum_ += other.sum_;
+        return *this;
+    }
+
+    [[nodiscard]] uint64_t count() const noexcept {
+        return count_;
+    }
+
+    [[nodiscard]] uint64_t sum() const noexcept {
+        return sum_;
+    }
+
+    [[nodiscard]] double mean() const noexcept {
+        return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+    }
+
+    // Upper bound of the bucket holding the q-th quantile, q in [0, 1]
+    [[nodiscard]] uint64_t percentile(double q) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+
+        const auto rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) *
+                                                static_cast<double>(count_ - 1));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < Buckets::Count; ++i) {
+            seen += counts_[i];
+            if (seen > rank) {
+                return Buckets::upperBound(i);
+            }
+        }
+        return Buckets::upperBound(Buckets::Count - 1);
+    }
+
+    [[nodiscard]] std::span<const uint64_t> buckets() const noexcept {
+        return counts_;
+    }
+
+ private:
+    std::array<uint64_t, Buckets::Count> counts_{};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+};
+
+/**
+ * @brief Concurrent log-linear histogram of latencies in nanoseconds
+ *
+ * Recording is a pair of relaxed increments in the shard of the calling thread,
+ * so threads rarely touch the same cache lines. Reading goes through snapshot().
+ */
+class LatencyHistogram {
+    using Buckets = detail::LogLinearBuckets;
+
+ public:
+    static constexpr size_t Shards = 8;
+
+    LatencyHistogram() = default;
+
+    // Pinned
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram(LatencyHistogram const&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram const&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    void record(uint64_t nanos) noexcept {
+        Shard& shard = shards_[detail::threadShard() % Shards];
+        shard.counts[Buckets::index(nanos)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(nanos, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] HistogramSnapshot snapshot() const noexcept {
+        HistogramSnapshot snapshot;
+        for (const Shard& shard : shards_) {
+            for (size_t i = 0; i < Buckets::Count; ++i) {
+                if (uint64_t n = shard.counts[i].load(std::memory_order_relaxed)) {
+                    snapshot.add(i, n);
+                }
+            }
+            snapshot.addSum(shard.sum.load(std::memory_order_relaxed));
+        }
+        return snapshot;
+    }
+
+ private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, Buckets::Count> counts{};
+        std::atomic<uint64_t> sum{0};
+    };
+
+    std::array<Shard, Shards> shards_{};
+};
+
+}  // namespace result
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "result/metrics/histogram.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace result {
+
+struct StageSnapshot {
+    std::string name;
+    HistogramSnapshot values;  // latencies of runs that produced a value
+    HistogramSnapshot errors;  // latencies of runs that produced an error
+
+    StageSnapshot& merge(const StageSnapshot& other) noexcept {
+        values.merge(other.values);
+        errors.merge(other.errors);
+        return *this;
+    }
+};
+
+// Latencies of one pipeline stage, split by outcome
+class StageStats {
+ public:
+    explicit StageStats(std::string name) : name_(std::move(name)) {}
+
+    // Pinned
+    StageStats(StageStats&&) = delete;
+    StageStats(StageStats const&) = delete;
+    StageStats& operator=(StageStats const&) = delete;
+    StageStats& operator=(StageStats&&) = delete;
+
+    void record(bool failed, std::chrono::nanoseconds latency) noexcept {
+        const auto nanos = static_cast<uint64_t>(latency.count());
+        (failed ? errors_ : values_).record(nanos);
+    }
+
+    [[nodiscard]] const std::string& name() const noexcept {
+        return name_;
+    }
+
+    [[nodiscard]] StageSnapshot snapshot() const {
+        return StageSnapshot{name_, values_.snapshot(), errors_.snapshot()};
+    }
+
+ private:
+    std::string name_;
+    LatencyHistogram values_;
+    LatencyHistogram errors_;
+};
+
+// Stages by name, created on first use and never destroyed before the registry
+class StageRegistry {
+ public:
+    StageRegistry() = default;
+
+    // Pinned
+    StageRegistry(StageRegistry&&) = delete;
+    StageRegistry(StageRegistry const&) = delete;
+    StageRegistry& operator=(StageRegistry const&) = delete;
+    StageRegistry& operator=(StageRegistry&&) = delete;
+
+    static StageRegistry& global() {
+        static StageRegistry registry;
+        return registry;
+    }
+
+    StageStats& stage(std::string_view name) {
+        std::lock_guard lock(mutex_);
+
+        auto it = stages_.find(name);
+        if (it == stages_.end()) {
+            auto stats = std::make_unique<StageStats>(std::string(name));
+            it = stages_.emplace(stats->name(), std::move(stats)).first;
+        }
+        return *it->second;
+    }
+
+    [[nodiscard]] std::vector<StageSnapshot> snapshot() const {
+        std::lock_guard lock(mutex_);
+
+        std::vector<StageSnapshot> snapshots;
+        snapshots.reserve(stages_.size());
+        for (const auto& [name, stats] : stages_) {
+            snapshots.push_back(stats->snapshot());
+        }
+        return snapshots;
+    }
+
+ private:
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<StageStats>, std::less<>> stages_;
+};
+
+namespace detail {
+
+// The stage of the global registry, looked up in a per-thread cache first
+inline StageStats& globalStage(std::string_view name) {
+    thread_local std::unordered_map<std::string_view, StageStats*> cache;
+
+    auto it = cache.find(name);
+    if (it == cache.end()) {
+        StageStats& stats = StageRegistry::global().stage(name);
+        it = cache.emplace(stats.name(), &stats).first;
+    }
+    return *it->second;
+}
+
+}  // namespace detail
+
+}  // namespace result
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Whether libc++ relocates types with a __trivially_relocatable member by memcpy, and tells
+// which of its own types it relocates so. Elsewhere only TriviallyRelocatable is consulted.
+#ifndef RESULT_LIBCPP_RELOCATION
+#if defined(_LIBCPP_VERSION) && _LIBCPP_VERSION >= 180000 && \
+    __has_include(<__type_traits/is_trivially_relocatable.h>)
+#define RESULT_LIBCPP_RELOCATION 1
+#else
+#define RESULT_LIBCPP_RELOCATION 0
+#endif
+#endif
+
+namespace result {
+
+namespace detail {
+
+template <typename T>
+consteval bool triviallyRelocatableByDefault() {
+#if RESULT_LIBCPP_RELOCATION
+    // Also covers the standard library types libc++ marks as relocatable, e.g. std::string
+    return std::__libcpp_is_trivially_relocatable<T>::value;
+#else
+    return std::is_trivially_copyable_v<T>;
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Whether moving a T and destroying the source is equivalent to copying its bytes
+ *
+ * True for trivially copyable types and, with libc++, for the library types it marks
+ * as relocatable. Specialize for your own types:
+ * @code
+ * template <>
+ * struct result::TriviallyRelocatable<Buffer> : std::true_type {};
+ * @endcode
+ */
+template <typename T>
+struct TriviallyRelocatable : std::bool_constant<detail::triviallyRelocatableByDefault<T>()> {};
+
+template <typename T>
+inline constexpr bool isTriviallyRelocatable = TriviallyRelocatable<std::remove_cv_t<T>>::value;
+
+// Move-constructs *to from *from and ends the lifetime of *from, returns the new object
+template <typename T>
+T* relocateAt(T* from, T* to) noexcept(isTriviallyRelocatable<T> ||
+                                       std::is_nothrow_move_constructible_v<T>) {
+    if constexpr (isTriviallyRelocatable<T>) {
+        std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), sizeof(T));
+        return std::launder(to);
+    } else {
+        T* result = std::construct_at(to, std::move(*from));
+        std::destroy_at(from);
+        return result;
+    }
+}
+
+// Relocates [first, last) into uninitialized memory at `to`, returns the end of the new range.
+// The ranges may overlap if `to` precedes `first`.
+template <typename T>
+T* uninitializedRelocate(T* first, T* last, T* to) noexcept(
+    isTriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>) {
+    if constexpr (isTriviallyRelocatable<T>) {
+        const auto count = static_cast<size_t>(last - first);
+        if (count != 0) {
+            std::memmove(static_cast<void*>(to),
+                         static_cast<const void*>(first),
+                         count * sizeof(T));
+        }
+        return to + count;
+    } else {
+        for (; first != last; ++first, ++to) {
+            relocateAt(first, to);
+        }
+        return to;
+    }
+}
+
+}  // namespace result
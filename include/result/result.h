@@ -1,30 +1,96 @@
 #pragma once
 
+#include "result/detail/allocator.h"
+#include "result/detail/attributes.h"
 #include "result/detail/min_sized_type.h"
 #include "result/detail/overloaded.h"
 #include "result/detail/propagate_category.h"
 #include "result/detail/strong_typedef.h"
 #include "result/detail/vtable.h"
+#include "result/error/exception.h"
+#include "result/relocate.h"
 
 #include <type_list/list.h>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if RESULT_ERROR_SAMPLING
+#include "result/detail/error_hook.h"
+#endif
 
 namespace result {
 
+/**
+ * @brief Names the error held by an error wrapper, such as Shared<E>
+ *
+ * Results convert between an error and its wrappers, Union keeps only the wrapper of the two,
+ * and pipe handlers are given the payload, see seeThrough(). Specializations provide
+ * `type` and a static `get(const Wrapper&)` returning the payload.
+ */
+template <typename E>
+struct ErrorPayload {
+    using type = E;
+};
+
+template <typename E>
+using ErrorPayloadOf = typename ErrorPayload<E>::type;
+
 namespace detail {
 
 struct Impossible {};
 
+// Index among Es of the alternative storing an error G: G itself, else one with its payload
+template <typename G, typename... Es>
+inline constexpr size_t StoredErrorIndex = [] {
+    // Ending with a match, found at sizeof...(Es) when there is none
+    const bool same[] = {std::is_same_v<G, Es>..., true};
+    const bool payload[] = {std::is_same_v<ErrorPayloadOf<G>, ErrorPayloadOf<Es>>..., true};
+
+    const auto first = [](const auto& matches) -> size_t {
+        return std::find(std::begin(matches), std::end(matches), true) - std::begin(matches);
+    };
+    return first(same) != sizeof...(Es) ? first(same) : first(payload);
+}();
+
+template <typename FromErrors, typename ToErrors>
+struct StoresErrors;
+
+template <typename... Gs, typename... Es>
+struct StoresErrors<tl::List<Gs...>, tl::List<Es...>>
+    : std::bool_constant<((StoredErrorIndex<Gs, Es...> < sizeof...(Es)) && ...)> {};
+
+// The handler's view of an error: the payload of a wrapper, the error itself otherwise
+template <typename E>
+RESULT_ALWAYS_INLINE decltype(auto) seeThrough(E&& error) noexcept {
+    using G = std::decay_t<E>;
+    if constexpr (std::is_same_v<ErrorPayloadOf<G>, G>) {
+        return std::forward<E>(error);
+    } else {
+        return ErrorPayload<G>::get(error);
+    }
+}
+
+template <typename E>
+using SeenThrough = decltype(seeThrough(std::declval<E>()));
+
+template <typename R>
+class ReturnSlot;
+
 template <typename From, typename To>
 concept ValueConvertibleTo =
     (std::is_convertible_v<typename From::ValueType, typename To::ValueType> ||
      std::is_same_v<typename From::ValueType, Impossible>);
 
 template <typename From, typename To>
-concept ErrorConvertibleTo = tl::SubsetOf<typename From::ErrorTypes, typename To::ErrorTypes>;
+concept ErrorConvertibleTo =
+    StoresErrors<typename From::ErrorTypes, typename To::ErrorTypes>::value;
 
 }  // namespace detail
 
@@ -38,9 +104,31 @@ struct err_tag_t {};  // NOLINT
 template <typename E>
 constexpr err_tag_t<E> err_tag;  //  NOLINT
 
+namespace detail {
+
+// Constructs an error like err_tag, for one made elsewhere and only passed on: converted,
+// propagated or collected. The error hook saw it when it was made.
+template <typename E>
+struct pass_tag_t {};  // NOLINT
+
+template <typename E>
+constexpr pass_tag_t<E> pass_tag;  //  NOLINT
+
+}  // namespace detail
+
 struct val_tag_t {};                 // NOLINT
 inline constexpr val_tag_t val_tag;  // NOLINT
 
+// Error types checked and visited as one, e.g. ErrorCategory<Timeout, Unavailable>
+template <typename... Es>
+using ErrorCategory = tl::List<Es...>;
+
+template <typename Category>
+struct category_tag_t {};  // NOLINT
+
+template <typename Category>
+constexpr category_tag_t<Category> category_tag;  // NOLINT
+
 template <typename V, typename... Es>
 class Result {
     static_assert(std::is_same_v<V, std::decay_t<V>>);
@@ -64,6 +152,22 @@ class Result {
     template <typename U>
     using RebindValue = Result<U, Es...>;
 
+    // The alternative storing an error G converted from another Result: G itself, or one with
+    // the same payload, see ErrorPayload
+    template <typename G>
+    using StoredError =
+        std::tuple_element_t<detail::StoredErrorIndex<G, Es...>, std::tuple<Es...>>;
+
+    // Relocating a Result is relocating its alternative, which lies at the start of data_
+    static constexpr bool IsTriviallyRelocatable =
+        isTriviallyRelocatable<V> && (isTriviallyRelocatable<Es> && ...);
+
+#if RESULT_LIBCPP_RELOCATION
+    // Lets libc++ containers relocate Results with memcpy
+    using __trivially_relocatable =  // NOLINT
+        std::conditional_t<IsTriviallyRelocatable, Result, void>;
+#endif
+
     ~Result() noexcept {
         destroy();
     }
@@ -88,13 +192,77 @@ class Result {
         set<Val>();
     }
 
+    // Every error made goes through here, see RESULT_ERROR_SAMPLING
+    template <typename... Args, std::constructible_from<Args...> E>
+    requires tl::Contains<ErrorTypes, E>
+    Result(err_tag_t<E>, Args&&... args)
+        : Result(detail::pass_tag<E>, std::forward<Args>(args)...) {
+#if RESULT_ERROR_SAMPLING
+        detail::onError(as<E>());
+#endif
+    }
+
     template <typename... Args, std::constructible_from<Args...> E>
     requires tl::Contains<ErrorTypes, E>
-    Result(err_tag_t<E>, Args&&... args) {
+    Result(detail::pass_tag_t<E>, Args&&... args) {
         new (ptr()) E(std::forward<Args>(args)...);
         set<E>();
     }
 
+    template <typename Alloc, typename... Args>
+    requires std::is_constructible_v<V, Args...>
+    Result(std::allocator_arg_t, const Alloc& alloc, std::in_place_t, Args&&... args) {
+        detail::constructUsingAllocator<V, Val>(ptr(), alloc, std::forward<Args>(args)...);
+        set<Val>();
+    }
+
+    template <typename Alloc, typename E, typename... Args>
+    requires tl::Contains<ErrorTypes, E>
+    Result(std::allocator_arg_t, const Alloc& alloc, err_tag_t<E>, Args&&... args)
+        : Result(std::allocator_arg, alloc, detail::pass_tag<E>, std::forward<Args>(args)...) {
+#if RESULT_ERROR_SAMPLING
+        detail::onError(as<E>());
+#endif
+    }
+
+    template <typename Alloc, typename E, typename... Args>
+    requires tl::Contains<ErrorTypes, E>
+    Result(std::allocator_arg_t, const Alloc& alloc, detail::pass_tag_t<E>, Args&&... args) {
+        detail::constructUsingAllocator<E, E>(ptr(), alloc, std::forward<Args>(args)...);
+        set<E>();
+    }
+
+    // Copies or converts with allocator-aware alternatives constructed using `alloc`
+    template <typename Alloc, ConvertibleTo<Self> R>
+    Result(std::allocator_arg_t, const Alloc& alloc, R&& from) {
+        using From = std::decay_t<R>;
+        using FromVal = detail::propagateConst<R, typename From::Val>;
+
+        From::VTable::dispatch(
+            detail::Overloaded{
+                [&](FromVal& val) {  //
+                    using FV = typename From::value_type;
+
+                    if constexpr (!std::is_same_v<FV, detail::Impossible>) {
+                        new (this) Result(
+                            std::allocator_arg,
+                            alloc,
+                            std::in_place,
+                            std::forward_like<R>(val.get()));
+                    } else {
+                        std::unreachable();
+                    }
+                },
+                [&]<typename G> RESULT_COLD (G& err) {
+                    using E = StoredError<std::decay_t<G>>;
+                    new (this) Result(
+                        std::allocator_arg, alloc, detail::pass_tag<E>, std::forward_like<R>(err));
+                },
+            },
+            from.ptr(),
+            from.index());
+    }
+
     Result(const Result& r) {
         construct(r);
     }
@@ -130,7 +298,7 @@ class Result {
     }
 
     template <typename F, typename Self>
-    decltype(auto) visit(this Self&& self, F&& f) {  // NOLINT
+    RESULT_ALWAYS_INLINE decltype(auto) visit(this Self&& self, F&& f) {  // NOLINT
         using RVal = detail::propagateConst<Self, Val>;
 
         return VTable::dispatch(
@@ -143,7 +311,7 @@ class Result {
     }
 
     template <typename F, typename Self>
-    decltype(auto) taggedVisit(this Self&& self, F&& f) {  // NOLINT
+    RESULT_ALWAYS_INLINE decltype(auto) taggedVisit(this Self&& self, F&& f) {  // NOLINT
         using RVal = detail::propagateConst<Self, Val>;
 
         return VTable::dispatch(
@@ -155,52 +323,112 @@ class Result {
             self.index());
     }
 
+    /**
+     * @brief Dispatches on the category of the error rather than on its type
+     *
+     * Calls `f(val_tag, value)` for a value and `f(category_tag<C>)` for an error, where C
+     * is the first of Categories listing its type. Every error type must be listed somewhere.
+     * @code
+     * using Retryable = ErrorCategory<Timeout, Unavailable>;
+     * using Fatal = ErrorCategory<BadRequest, Forbidden>;
+     *
+     * r.visitCategory<Retryable, Fatal>(Overloaded{
+     *     [](val_tag_t, const Reply& reply) { return respond(reply); },
+     *     [](category_tag_t<Retryable>) { return retryLater(); },
+     *     [](category_tag_t<Fatal>) { return reject(); },
+     * });
+     * @endcode
+     */
+    template <typename... Categories, typename F, typename Self>
+    decltype(auto) visitCategory(this Self&& self, F&& f) {  // NOLINT
+        static_assert(sizeof...(Categories) > 0);
+        static_assert((Categorized<Es, Categories...> && ...),
+                      "visitCategory: every error type must belong to one of the categories");
+
+        using Fn = std::remove_reference_t<F>;
+        using First = std::tuple_element_t<0, std::tuple<Categories...>>;
+        using Ret = decltype(f(category_tag<First>));
+        using Handler = Ret (*)(Fn&, Self&&);
+
+        static constexpr Handler Handlers[] = {
+            [](Fn& fn, Self&& r) -> Ret {
+                if constexpr (std::is_same_v<V, detail::Impossible>) {
+                    std::unreachable();
+                } else {
+                    return fn(val_tag, std::forward<Self>(r).value());
+                }
+            },
+            [](Fn& fn, Self&&) -> Ret { return fn(category_tag<Categories>); }...,
+        };
+
+        return Handlers[CategoryIndex<Categories...>[self.index_]](f, std::forward<Self>(self));
+    }
+
     template <typename Self>
-    decltype(auto) operator*(this Self&& self) {
+    RESULT_ALWAYS_INLINE decltype(auto) operator*(this Self&& self) {
         return std::forward<Self>(self).value();
     }
 
     template <typename Self>
-    decltype(auto) operator->(this Self& self) {
+    RESULT_ALWAYS_INLINE decltype(auto) operator->(this Self& self) {
         return &self.value();
     }
 
     template <typename U, typename Self>
-    [[nodiscard]] V valueOr(this Self&& self, U&& default_value) {
+    RESULT_ALWAYS_INLINE [[nodiscard]] V valueOr(this Self&& self, U&& default_value) {
         return self.hasValue() ? std::forward<Self>(self).value()
                                : static_cast<V>(std::forward<U>(default_value));
     }
 
     template <typename Self>
-    [[nodiscard]] decltype(auto) value(this Self&& self) {
+    RESULT_ALWAYS_INLINE [[nodiscard]] decltype(auto) value(this Self&& self) {
         return std::forward<Self>(self).template as<Val>().get();
     }
 
+    // The value, or the error thrown as an exception, see catching() for the reverse
+    template <typename Self>
+    RESULT_ALWAYS_INLINE [[nodiscard]] decltype(auto) valueOrThrow(this Self&& self) {
+        if (self.hasAnyError()) [[unlikely]] {
+            std::forward<Self>(self).throwError();
+        }
+        return std::forward<Self>(self).value();
+    }
+
     template <typename E, typename Self>
     requires tl::Contains<ErrorTypes, E>
-    [[nodiscard]] decltype(auto) error(this Self&& self) {
+    RESULT_ALWAYS_INLINE [[nodiscard]] decltype(auto) error(this Self&& self) {
         return std::forward<Self>(self).template as<E>();
     }
 
-    [[nodiscard]] bool hasValue() const noexcept {
+    RESULT_ALWAYS_INLINE [[nodiscard]] bool hasValue() const noexcept {
         return is<Val>();
     }
 
-    [[nodiscard]] bool hasAnyError() const noexcept {
+    RESULT_ALWAYS_INLINE [[nodiscard]] bool hasAnyError() const noexcept {
         return !hasValue();
     }
 
-    [[nodiscard]] explicit operator bool() const noexcept {
+    RESULT_ALWAYS_INLINE [[nodiscard]] explicit operator bool() const noexcept {
         return !hasAnyError();
     }
 
     template <typename E>
     requires tl::Contains<ErrorTypes, E>
-    [[nodiscard]] bool hasError() const noexcept {
+    RESULT_ALWAYS_INLINE [[nodiscard]] bool hasError() const noexcept {
         return is<E>();
     }
 
-    [[nodiscard]] size_t index() const noexcept {
+    // Whether the error is one of Category, a single test of a constexpr mask
+    template <typename Category>
+    RESULT_ALWAYS_INLINE [[nodiscard]] bool hasErrorIn() const noexcept {
+        if constexpr (1 + sizeof...(Es) <= 64) {
+            return (CategoryMask<Category> >> index_) & 1U;
+        } else {
+            return CategoryIndex<Category>[index_] == 1;
+        }
+    }
+
+    RESULT_ALWAYS_INLINE [[nodiscard]] size_t index() const noexcept {
         return index_;
     }
 
@@ -215,12 +443,33 @@ class Result {
     }
 
  private:
+    template <typename Self>
+    [[noreturn]] RESULT_COLD void throwError(this Self&& self) {
+        std::forward<Self>(self).taggedVisit(detail::Overloaded{
+            [](val_tag_t, auto&&) { std::unreachable(); },
+            []<typename G>(G&& error) {
+                // What catching() caught goes back out as the original exception
+                if constexpr (std::is_same_v<std::decay_t<G>, ExceptionError>) {
+                    error.rethrow();
+                } else {
+                    throw std::forward<G>(error);
+                }
+            },
+        });
+        std::unreachable();
+    }
+
     template <ConvertibleTo<Self> R>
     void construct(R&& from) {  // NOLINT
         using From = std::decay_t<R>;
         using FromVTable = typename From::VTable;
         using FromVal = detail::propagateConst<R, typename From::Val>;
 
+        if constexpr (BitwiseConvertibleFrom<From>) {
+            copyBits(from);
+            return;
+        }
+
         FromVTable::dispatch(
             detail::Overloaded{
                 [&](FromVal& val) {  //
@@ -232,9 +481,9 @@ class Result {
                         std::unreachable();
                     }
                 },
-                [&]<typename G>(G& err) {
-                    using E = std::decay_t<G>;
-                    new (this) Result(err_tag<E>, std::forward_like<R>(err));
+                [&]<typename G> RESULT_COLD (G& err) {
+                    using E = StoredError<std::decay_t<G>>;
+                    new (this) Result(detail::pass_tag<E>, std::forward_like<R>(err));
                 },
             },
             from.ptr(),
@@ -252,6 +501,12 @@ class Result {
         using From = std::decay_t<R>;
         using FromVal = detail::propagateConst<R, typename From::Val>;
 
+        // Nothing to destroy, nothing to dispatch on
+        if constexpr (IsTriviallyCopyable && BitwiseConvertibleFrom<From>) {
+            copyBits(from);
+            return;
+        }
+
         From::VTable::dispatch(
             detail::Overloaded{
                 [&](FromVal& val) {  //
@@ -271,22 +526,93 @@ class Result {
                         std::unreachable();
                     }
                 },
-                [&]<typename G>(G& err) {
-                    using E = std::decay_t<G>;
+                [&]<typename G> RESULT_COLD (G& err) {
+                    using E = StoredError<std::decay_t<G>>;
 
-                    if (is<E>()) {
-                        error<E>() = std::forward_like<R>(err);
-                    } else {
-                        destroy();
-                        new (this) Result(err_tag<E>, std::forward_like<R>(err));
+                    if constexpr (std::is_same_v<E, std::decay_t<G>>) {
+                        if (is<E>()) {
+                            error<E>() = std::forward_like<R>(err);
+                            return;
+                        }
                     }
+
+                    destroy();
+                    new (this) Result(detail::pass_tag<E>, std::forward_like<R>(err));
                 },
             },
             from.ptr(),
             from.index());
     }
 
+    // From holds one of our alternatives, and its bytes are all there is to it
+    template <typename From>
+    static constexpr bool BitwiseConvertibleFrom =
+        From::IsTriviallyCopyable &&
+        (std::is_same_v<typename From::value_type, V> ||
+         std::is_same_v<typename From::value_type, detail::Impossible>) &&
+        tl::SubsetOf<typename From::ErrorTypes, ErrorTypes>;
+
+    static constexpr bool IsTriviallyCopyable =
+        std::is_trivially_copyable_v<V> && (std::is_trivially_copyable_v<Es> && ...);
+
+    // Index of each of our alternatives among the alternatives of To
+    template <typename To>
+    static constexpr typename To::IndexType IndexRemap[1 + sizeof...(Es)] = {
+        tl::Find<typename To::Val, typename To::Types>,
+        tl::Find<Es, typename To::Types>...,
+    };
+
+    // Bit i is set when alternative i is an error listed in Category
+    template <typename Category>
+    static constexpr uint64_t CategoryMask = [] {
+        const bool listed[] = {false, tl::Contains<Category, Es>...};
+        uint64_t mask = 0;
+        for (size_t i = 0; i < std::size(listed); ++i) {
+            mask |= static_cast<uint64_t>(listed[i]) << i;
+        }
+        return mask;
+    }();
+
+    // 1 + position of the first of Categories listing E, 1 + sizeof...(Categories) if none
+    template <typename E, typename... Categories>
+    static constexpr size_t FirstCategory = [] {
+        const bool listed[] = {tl::Contains<Categories, E>..., false};
+        size_t i = 0;
+        while (i < sizeof...(Categories) && !listed[i]) {
+            ++i;
+        }
+        return 1 + i;
+    }();
+
+    template <typename E, typename... Categories>
+    static constexpr bool Categorized =
+        FirstCategory<E, Categories...> <= sizeof...(Categories);
+
+    // Category of each alternative, 0 for the value
+    template <typename... Categories>
+    static constexpr uint8_t CategoryIndex[1 + sizeof...(Es)] = {
+        0,
+        static_cast<uint8_t>(FirstCategory<Es, Categories...>)...,
+    };
+
+    // Conversion without dispatch: the storage as is and the index through a constexpr table
+    template <typename From>
+    void copyBits(const From& from) noexcept {
+        std::memcpy(&data_, &from.data_, sizeof(from.data_));
+
+        if constexpr (std::is_same_v<From, Self>) {
+            index_ = from.index_;
+        } else {
+            index_ = From::template IndexRemap<Self>[from.index_];
+        }
+    }
+
     void destroy() noexcept {
+        if constexpr (std::is_trivially_destructible_v<V> &&
+                      (std::is_trivially_destructible_v<Es> && ...)) {
+            return;
+        }
+
         VTable::dispatch(
             []<typename T>(T& value) {
                 using U = std::decay_t<T>;
@@ -298,28 +624,34 @@ class Result {
 
     template <typename T>
     requires tl::Contains<Types, T>
-    void set() {
+    RESULT_ALWAYS_INLINE void set() {
         index_ = tl::Find<T, Types>;
     }
 
     template <typename T>
     requires tl::Contains<Types, T>
-    bool is() const noexcept {
+    RESULT_ALWAYS_INLINE bool is() const noexcept {
         return index_ == tl::Find<T, Types>;
     }
 
     template <typename T, typename Self>
     requires tl::Contains<Types, T>
-    decltype(auto) as(this Self&& self) noexcept {
+    RESULT_ALWAYS_INLINE decltype(auto) as(this Self&& self) noexcept {
         using U = detail::propagateCategory<Self&&, T>;
         return reinterpret_cast<U>(std::forward<Self>(self).data_);  // NOLINT
     }
 
-    void* ptr() noexcept {
+    // Leaves the object without an alternative until the coroutine body fills it,
+    // see detail::ReturnSlot
+    explicit Result(detail::ReturnSlot<Result>& slot) noexcept {
+        slot.bind(this);
+    }
+
+    RESULT_ALWAYS_INLINE void* ptr() noexcept {
         return &data_;
     }
 
-    const void* ptr() const noexcept {
+    RESULT_ALWAYS_INLINE const void* ptr() const noexcept {
         return &data_;
     }
 
@@ -328,8 +660,14 @@ class Result {
 
     template <typename U, typename... Gs>
     friend class Result;
+
+    friend class detail::ReturnSlot<Result>;
 };
 
+template <typename V, typename... Es>
+struct TriviallyRelocatable<Result<V, Es...>>
+    : std::bool_constant<Result<V, Es...>::IsTriviallyRelocatable> {};
+
 struct Unit {};
 
 inline constexpr Unit unit{};  // NOLINT
@@ -337,15 +675,37 @@ inline constexpr Unit unit{};  // NOLINT
 template <typename... Es>
 using Status = Result<Unit, Es...>;
 
+// Error construction is outlined, see RESULT_COLD
 template <typename E>
-Result<detail::Impossible, std::decay_t<E>> makeError(E&& error) {
+RESULT_COLD Result<detail::Impossible, std::decay_t<E>> makeError(E&& error) {
     using G = std::decay_t<E>;
     return Result<detail::Impossible, G>(err_tag<G>, std::forward<E>(error));
 }
 
 template <typename E, typename... Args>
-Result<detail::Impossible, std::decay_t<E>> makeError(Args&&... args) {
+RESULT_COLD Result<detail::Impossible, std::decay_t<E>> makeError(Args&&... args) {
     return Result<detail::Impossible, E>(err_tag<E>, std::forward<Args>(args)...);
 }
 
+// Constructs the error by uses-allocator construction
+template <typename E, typename Alloc, typename... Args>
+RESULT_COLD Result<detail::Impossible, std::decay_t<E>> makeError(
+    std::allocator_arg_t, Alloc&& alloc, Args&&... args) {
+    return Result<detail::Impossible, E>(
+        std::allocator_arg, alloc, err_tag<E>, std::forward<Args>(args)...);
+}
+
+namespace detail {
+
+template <typename Alloc, typename E>
+Result<Impossible, std::decay_t<E>> makeErrorWith(const Alloc& alloc, E&& error) {
+    if constexpr (std::is_same_v<Alloc, NoAllocator>) {
+        return makeError(std::forward<E>(error));
+    } else {
+        return makeError<std::decay_t<E>>(std::allocator_arg, alloc, std::forward<E>(error));
+    }
+}
+
+}  // namespace detail
+
 }  // namespace result
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "result/detail/attributes.h"
+#include "result/detail/error_hook.h"
+#include "result/detail/spsc_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+static_assert(RESULT_ERROR_SAMPLING,
+              "ErrorSampler sees errors only with RESULT_ERROR_SAMPLING defined to 1 "
+              "in the whole program");
+
+namespace result {
+
+// Error payload captured by ErrorSampler
+struct ErrorSample {
+    std::string_view type;
+    detail::ErrorRendering message;
+    std::chrono::system_clock::time_point time;
+};
+
+/**
+ * @brief Opt-in capture of example error payloads
+ *
+ * While enabled, every `every`-th error made on each thread is rendered into
+ * a bounded per-thread ring, which a background thread empties with drain():
+ * @code
+ * ErrorSampler::global().enable(1000);
+ * ...
+ * ErrorSampler::global().drain([](const ErrorSample& s) { log(s.type, s.message.message()); });
+ * @endcode
+ * Producers never block or allocate after their first sample: when a ring is full,
+ * the sample is dropped and counted. While disabled the cost is one relaxed load per error.
+ */
+class ErrorSampler {
+ public:
+    static constexpr size_t RingCapacity = 256;
+
+    // Pinned
+    ErrorSampler(ErrorSampler&&) = delete;
+    ErrorSampler(ErrorSampler const&) = delete;
+    ErrorSampler& operator=(ErrorSampler const&) = delete;
+    ErrorSampler& operator=(ErrorSampler&&) = delete;
+
+    static ErrorSampler& global() {
+        static ErrorSampler sampler;
+        return sampler;
+    }
+
+    // Samples one error in `every` per thread
+    void enable(uint32_t every = 1) noexcept {
+        every_.store(std::max(every, 1U), std::memory_order_relaxed);
+        detail::error_hook.store(&capture, std::memory_order_release);
+    }
+
+    void disable() noexcept {
+        detail::error_hook.store(nullptr, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool enabled() const noexcept {
+        return detail::error_hook.load(std::memory_order_relaxed) == &capture;
+    }
+
+    // Passes every captured sample to `consume` and returns their number
+    template <typename F>
+    size_t drain(F&& consume) {
+        std::lock_guard lock(mutex_);
+
+        size_t count = 0;
+        for (const auto& buffer : buffers_) {
+            count += buffer->ring.drain(consume);
+        }
+
+        // Buffers of exited threads are not referenced by anyone else
+        std::erase_if(buffers_, [this](const std::shared_ptr<Buffer>& buffer) {
+            if (buffer.use_count() != 1) {
+                return false;
+            }
+            retired_dropped_ += buffer->dropped.load(std::memory_order_relaxed);
+            return true;
+        });
+        return count;
+    }
+
+    // Number of samples lost because a ring was full
+    [[nodiscard]] uint64_t dropped() const {
+        std::lock_guard lock(mutex_);
+
+        uint64_t dropped = retired_dropped_;
+        for (const auto& buffer : buffers_) {
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+ private:
+    // The hook is process-wide, so is the sampler, see global()
+    ErrorSampler() = default;
+
+    struct Buffer {
+        detail::SpscRing<ErrorSample, RingCapacity> ring;
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    // The ring of the calling thread, registered on first use
+    static Buffer* localBuffer() noexcept {
+        thread_local std::shared_ptr<Buffer> buffer;
+        if (buffer == nullptr) [[unlikely]] {
+            try {
+                auto fresh = std::make_shared<Buffer>();
+                ErrorSampler& self = global();
+                std::lock_guard lock(self.mutex_);
+                self.buffers_.push_back(fresh);
+                buffer = std::move(fresh);
+            } catch (...) {
+                return nullptr;
+            }
+        }
+        return buffer.get();
+    }
+
+    static void capture(std::string_view type,
+                        const void* error,
+                        detail::RenderError render) noexcept {
+        thread_local uint32_t countdown = 0;
+        if (countdown > 1) {
+            --countdown;
+            return;
+        }
+        countdown = global().every_.load(std::memory_order_relaxed);
+
+        Buffer* buffer = localBuffer();
+        if (buffer == nullptr) {
+            return;
+        }
+
+        ErrorSample sample{type, {}, std::chrono::system_clock::now()};
+        render(error, sample.message);
+        if (!buffer->ring.tryPush(sample)) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint32_t> every_{1};
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+    uint64_t retired_dropped_ = 0;
+};
+
+}  // namespace result
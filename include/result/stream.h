@@ -0,0 +1,4 @@
+#pragma once
+
+#include "result/stream/generator.h"
+#include "result/stream/pipe.h"
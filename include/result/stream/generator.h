@@ -0,0 +1,218 @@
+#pragma once
+
+#include "result/coro.h"
+#include "result/error/exception.h"
+#include "result/result.h"
+#include "result/traits.h"
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+template <SomeResult R>
+class Generator;
+
+namespace detail {
+
+template <SomeResult R>
+class GeneratorPromise {
+ public:
+    GeneratorPromise() = default;
+
+    Generator<R> get_return_object() noexcept {  // NOLINT
+        return Generator<R>(std::coroutine_handle<GeneratorPromise>::from_promise(*this));
+    }
+
+    auto initial_suspend() noexcept {  // NOLINT
+        return std::suspend_always{};
+    }
+
+    auto final_suspend() noexcept {  // NOLINT
+        return std::suspend_always{};
+    }
+
+    // An exception escaping the body is the last element when R lists ExceptionError
+    void unhandled_exception() noexcept {  // NOLINT
+        if constexpr (tl::Contains<ErrorTypesOf<R>, ExceptionError>) {
+            last_.emplace(err_tag<ExceptionError>, std::current_exception());
+            current_ = std::addressof(*last_);
+        } else {
+            std::terminate();
+        }
+    }
+
+    void return_void() noexcept {}  // NOLINT
+
+    // The operand outlives the suspension, so it is handed out in place
+    auto yield_value(R&& r) noexcept {  // NOLINT
+        current_ = std::addressof(r);
+        return std::suspend_always{};
+    }
+
+    // Values, errors and other Results are converted into R kept in the awaiter
+    template <typename U>
+    requires std::is_constructible_v<R, U>
+    auto yield_value(U&& x) {  // NOLINT
+        struct Awaiter {
+            R element;
+            GeneratorPromise* promise;
+
+            bool await_ready() noexcept {  // NOLINT
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<>) noexcept {  // NOLINT
+                promise->current_ = std::addressof(element);
+            }
+
+            void await_resume() noexcept {}  // NOLINT
+        };
+
+        return Awaiter{R(std::forward<U>(x)), this};
+    }
+
+    // A failed co_await yields its error as the last element of the stream
+    template <typename G>
+    void returnError(G&& error) {
+        using E = typename R::template StoredError<std::decay_t<G>>;
+        last_.emplace(detail::pass_tag<E>, std::forward<G>(error));
+        current_ = std::addressof(*last_);
+    }
+
+    std::coroutine_handle<> unwind() noexcept {
+        stopped_ = true;
+        return std::noop_coroutine();
+    }
+
+    // Runs the coroutine up to the next element, returns false at the end of the stream
+    bool advance() {
+        auto h = std::coroutine_handle<GeneratorPromise>::from_promise(*this);
+
+        current_ = nullptr;
+        if (!stopped_ && !h.done()) {
+            h.resume();
+        }
+        return current_ != nullptr;
+    }
+
+    R& current() noexcept {
+        assert(current_ != nullptr);
+        return *current_;
+    }
+
+ private:
+    R* current_ = nullptr;
+    std::optional<R> last_;
+    bool stopped_ = false;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lazy stream of Results produced by a coroutine
+ *
+ * The coroutine yields values, errors or whole Results, one element at a time, and may
+ * co_await Results: a failed co_await yields its error as the last element.
+ * @code
+ * Generator<Result<Row, IoError, ParseError>> rows(File& file) {
+ *     while (auto line = co_await file.readLine()) {   // IoError ends the stream
+ *         co_yield parseRow(*line);                     // ParseError is just an element
+ *     }
+ * }
+ *
+ * for (auto& row : rows(file) | stopOnError() | map(normalize)) { ... }
+ * @endcode
+ * Elements are handed out by reference and are only valid until the next one is requested.
+ */
+template <SomeResult R>
+class [[nodiscard]] Generator {
+ public:
+    using promise_type = detail::GeneratorPromise<R>;  // NOLINT
+
+    class Iterator {
+     public:
+        using value_type = R;  // NOLINT
+        using difference_type = std::ptrdiff_t;  // NOLINT
+
+        Iterator() = default;
+
+        R& operator*() const noexcept {
+            return promise_->current();
+        }
+
+        R* operator->() const noexcept {
+            return std::addressof(promise_->current());
+        }
+
+        Iterator& operator++() {
+            if (!promise_->advance()) {
+                promise_ = nullptr;
+            }
+            return *this;
+        }
+
+        void operator++(int) {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept {
+            return promise_ == nullptr;
+        }
+
+     private:
+        friend class Generator;
+
+        explicit Iterator(promise_type* promise) noexcept : promise_(promise) {}
+
+        promise_type* promise_ = nullptr;
+    };
+
+    explicit Generator(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+
+    Generator(Generator&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() noexcept {
+        reset();
+    }
+
+    // Starts the coroutine, a generator can be iterated only once
+    Iterator begin() {
+        auto& promise = handle_.promise();
+        return Iterator(promise.advance() ? &promise : nullptr);
+    }
+
+    std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+
+ private:
+    void reset() noexcept {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+}  // namespace result
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "result/stream/generator.h"
+#include "result/traits.h"
+
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+template <typename C, typename R>
+concept StreamPipe = requires(C c, Generator<R> g) { std::move(c).stream(std::move(g)); };
+
+template <typename C, typename R>
+using PipedElement = decltype(std::declval<C&>().pipe(std::declval<R>()));
+
+// Applies an element pipe from include/result/combine to every element as it is pulled
+template <SomeResult R, typename C>
+Generator<PipedElement<C, R>> pipeEach(Generator<R> g, C c) {
+    for (R& r : g) {
+        co_yield c.pipe(std::move(r));
+    }
+}
+
+}  // namespace detail
+
+namespace pipe {
+
+struct [[nodiscard]] StopOnError {
+    template <SomeResult R>
+    static Generator<R> stream(Generator<R> g) {
+        for (R& r : g) {
+            const bool failed = r.hasAnyError();
+            co_yield std::move(r);
+
+            if (failed) {
+                co_return;
+            }
+        }
+    }
+};
+
+}  // namespace pipe
+
+// Ends the stream after its first error
+inline auto stopOnError() {
+    return pipe::StopOnError{};
+}
+
+}  // namespace result
+
+// Stream-level pipes, e.g. `rows | stopOnError()`, or any pipe on Results applied element-wise,
+// e.g. `rows | map(f) | andThen(g) | mapErr(h)`
+template <typename R, typename C>
+auto operator|(result::Generator<R> g, C c) {
+    if constexpr (result::detail::StreamPipe<C, R>) {
+        return std::move(c).stream(std::move(g));
+    } else {
+        return result::detail::pipeEach(std::move(g), std::move(c));
+    }
+}
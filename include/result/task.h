@@ -0,0 +1,7 @@
+#pragma once
+
+#include "result/task/executor.h"
+#include "result/task/race.h"
+#include "result/task/sync_wait.h"
+#include "result/task/task.h"
+#include "result/task/thread_pool.h"
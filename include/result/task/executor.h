@@ -0,0 +1,43 @@
+#pragma once
+
+#include <coroutine>
+
+namespace result {
+
+template <typename E>
+concept Executor = requires(E& executor, std::coroutine_handle<> h) { executor.execute(h); };
+
+// Resumes scheduled coroutines on the calling thread
+class InlineExecutor {
+ public:
+    void execute(std::coroutine_handle<> h) {
+        h.resume();
+    }
+};
+
+namespace detail {
+
+template <Executor E>
+struct ScheduleAwaiter {
+    E* executor;
+
+    bool await_ready() noexcept {  // NOLINT
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> h) {  // NOLINT
+        executor->execute(h);
+    }
+
+    void await_resume() noexcept {}  // NOLINT
+};
+
+}  // namespace detail
+
+// co_await schedule(executor) continues the current coroutine on the executor
+template <Executor E>
+detail::ScheduleAwaiter<E> schedule(E& executor) noexcept {
+    return detail::ScheduleAwaiter<E>{&executor};
+}
+
+}  // namespace result
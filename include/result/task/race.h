@@ -0,0 +1,190 @@
+#pragma once
+
+#include "result/result.h"
+#include "result/task/executor.h"
+#include "result/task/sync_wait.h"
+#include "result/traits.h"
+#include "result/union.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+// Alternatives may take a std::stop_token to notice that they lost the race
+template <typename F>
+decltype(auto) invokeAlternative(F& f, std::stop_token token) {
+    if constexpr (std::is_invocable_v<F&, std::stop_token>) {
+        return std::invoke(f, std::move(token));
+    } else {
+        return std::invoke(f);
+    }
+}
+
+template <typename F>
+using AlternativeResult =
+    std::decay_t<decltype(invokeAlternative(std::declval<F&>(), std::stop_token()))>;
+
+template <typename... Fs>
+using RaceValue = ValueTypeOf<std::tuple_element_t<0, std::tuple<AlternativeResult<Fs>...>>>;
+
+template <typename... Fs>
+using RaceResult = Union<RaceValue<Fs...>, AlternativeResult<Fs>...>;
+
+/**
+ * @brief Outcome of a race between alternatives, shared with the ones still running
+ *
+ * Decided by the first value, or once every alternative has failed, with the error
+ * of the earliest of them in argument order.
+ */
+template <SomeResult R>
+class RaceState {
+ public:
+    explicit RaceState(size_t alternatives) : remaining_(alternatives) {}
+
+    [[nodiscard]] std::stop_token token() const noexcept {
+        return stop_.get_token();
+    }
+
+    template <SomeResult From>
+    void complete(size_t index, From&& r) {
+        std::lock_guard lock(mutex_);
+        if (decided_) {
+            return;
+        }
+
+        if (r.hasValue()) {
+            out_.emplace(std::forward<From>(r));
+            decide();
+            return;
+        }
+
+        ++failed_;
+        if (!out_.has_value() || index < error_index_) {
+            out_.emplace(std::forward<From>(r));
+            error_index_ = index;
+        }
+        if (--remaining_ == 0) {
+            decide();
+            return;
+        }
+
+        // Ends waitToHedge() early once all started alternatives failed
+        cv_.notify_one();
+    }
+
+    // Waits for `delay`, or less if the race is decided or all `started` alternatives failed.
+    // Returns whether the race is still undecided.
+    template <typename Rep, typename Period>
+    bool waitToHedge(size_t started, std::chrono::duration<Rep, Period> delay) {
+        std::unique_lock lock(mutex_);
+        cv_.wait_for(lock, delay, [&] { return decided_ || failed_ == started; });
+        return !decided_;
+    }
+
+    R wait() {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [&] { return decided_; });
+        return std::move(*out_);
+    }
+
+ private:
+    void decide() {
+        decided_ = true;
+        stop_.request_stop();
+
+        // Notified under the lock, like in syncWait
+        cv_.notify_one();
+    }
+
+    std::stop_source stop_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool decided_ = false;
+    size_t remaining_;
+    size_t failed_ = 0;
+    size_t error_index_ = 0;
+    std::optional<R> out_;
+};
+
+template <SomeResult R, Executor E, typename F>
+Detached runAlternative(E& executor, F f, size_t index, std::shared_ptr<RaceState<R>> state) {
+    co_await schedule(executor);
+
+    // Lost before it even started
+    if (state->token().stop_requested()) {
+        co_return;
+    }
+
+    state->complete(index, invokeAlternative(f, state->token()));
+}
+
+// Starts the alternatives one by one, each after `delay` or after all the started ones failed
+template <Executor E, typename Rep, typename Period, typename... Fs>
+RaceResult<Fs...> race(E& executor, std::chrono::duration<Rep, Period> delay, Fs... fs) {
+    using R = RaceResult<Fs...>;
+    static_assert((std::is_same_v<ValueTypeOf<AlternativeResult<Fs>>, RaceValue<Fs...>> && ...),
+                  "Alternatives of a race must have the same value type");
+
+    auto state = std::make_shared<RaceState<R>>(sizeof...(Fs));
+    size_t started = 0;
+
+    auto start = [&]<typename F>(F& f) {
+        if (started == 0 || delay == delay.zero() || state->waitToHedge(started, delay)) {
+            runAlternative<R>(executor, std::move(f), started, state);
+        }
+        ++started;
+    };
+    (start(fs), ...);
+
+    return state->wait();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Runs the alternatives concurrently on the executor and returns the first value
+ *
+ * If every alternative fails, returns the error of the earliest one in argument order.
+ * The losers are cancelled cooperatively: those taking a std::stop_token see a stop
+ * request, those not started yet are skipped. Losers may still run after firstOk() returns,
+ * so they must not capture locals by reference, and the executor must outlive them.
+ * @code
+ * Result<Row, Timeout, IoError> row = firstOk(pool,
+ *     [=](std::stop_token t) { return replicas[0]->read(key, t); },
+ *     [=](std::stop_token t) { return replicas[1]->read(key, t); });
+ * @endcode
+ */
+template <Executor E, typename... Fs>
+requires(sizeof...(Fs) > 0)
+detail::RaceResult<Fs...> firstOk(E& executor, Fs... alternatives) {
+    return detail::race(executor, std::chrono::nanoseconds::zero(), std::move(alternatives)...);
+}
+
+/**
+ * @brief Runs `primary`, and `backup` as well if primary has no value after `delay`
+ *
+ * Returns the first value of the two. If primary fails before the delay, backup starts
+ * right away. Cancellation and the error on failure of both are as in firstOk().
+ */
+template <Executor E, typename Primary, typename Backup, typename Rep, typename Period>
+detail::RaceResult<Primary, Backup> hedge(E& executor,
+                                          Primary primary,
+                                          Backup backup,
+                                          std::chrono::duration<Rep, Period> delay) {
+    return detail::race(executor, delay, std::move(primary), std::move(backup));
+}
+
+}  // namespace result
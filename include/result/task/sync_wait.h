@@ -0,0 +1,75 @@
+#pragma once
+
+#include "result/task/executor.h"
+#include "result/task/task.h"
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+namespace result {
+
+namespace detail {
+
+// Fire-and-forget coroutine, its frame is freed on completion
+struct Detached {
+    struct promise_type {  // NOLINT
+        Detached get_return_object() noexcept {  // NOLINT
+            return {};
+        }
+
+        auto initial_suspend() noexcept {  // NOLINT
+            return std::suspend_never{};
+        }
+
+        auto final_suspend() noexcept {  // NOLINT
+            return std::suspend_never{};
+        }
+
+        void return_void() noexcept {}  // NOLINT
+
+        [[noreturn]] void unhandled_exception() noexcept {  // NOLINT
+            std::terminate();
+        }
+    };
+};
+
+}  // namespace detail
+
+// Runs the task on the executor and blocks the calling thread until it completes
+template <Executor E, typename R>
+R syncWait(E& executor, Task<R> task) {
+    std::optional<R> out;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+
+    [](E& executor,
+       Task<R> task,
+       std::optional<R>& out,
+       std::mutex& mutex,
+       std::condition_variable& cv,
+       bool& done) -> detail::Detached {
+        co_await schedule(executor);
+        out.emplace(co_await std::move(task).result());
+
+        // Notified under the lock, so that the waiter cannot destroy cv before we are done
+        std::lock_guard lock(mutex);
+        done = true;
+        cv.notify_one();
+    }(executor, std::move(task), out, mutex, cv, done);
+
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [&] { return done; });
+    return std::move(*out);
+}
+
+template <typename R>
+R syncWait(Task<R> task) {
+    InlineExecutor executor;
+    return syncWait(executor, std::move(task));
+}
+
+}  // namespace result
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "result/coro.h"
+#include "result/error/exception.h"
+#include "result/result.h"
+#include "result/traits.h"
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace result {
+
+template <typename R>
+class Task;
+
+namespace detail {
+
+template <typename T, typename... Es>
+struct TaskPromise {
+    using ResultType = Result<T, Es...>;
+
+    // Finishes the awaiting coroutine with an error of this task instead of resuming it
+    using Propagate = std::coroutine_handle<> (*)(std::coroutine_handle<>, ResultType&&);
+
+    struct FinalAwaiter {
+        bool await_ready() noexcept {  // NOLINT
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(  // NOLINT
+            std::coroutine_handle<TaskPromise> h) noexcept {
+            auto& promise = h.promise();
+            assert(promise.result.has_value());
+
+            if (promise.propagate != nullptr && promise.result->hasAnyError()) {
+                return promise.propagate(promise.continuation, std::move(*promise.result));
+            }
+
+            return promise.continuation;
+        }
+
+        void await_resume() noexcept {}  // NOLINT
+    };
+
+    TaskPromise() = default;
+
+    Task<ResultType> get_return_object() noexcept {  // NOLINT
+        return Task<ResultType>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    auto initial_suspend() noexcept {  // NOLINT
+        return std::suspend_always{};
+    }
+
+    auto final_suspend() noexcept {  // NOLINT
+        return FinalAwaiter{};
+    }
+
+    // Exceptions escaping the body finish the task with an error when ExceptionError is
+    // one of Es, as in Result coroutines
+    void unhandled_exception() noexcept {  // NOLINT
+        if constexpr (tl::Contains<tl::List<Es...>, ExceptionError>) {
+            result.emplace(err_tag<ExceptionError>, std::current_exception());
+        } else {
+            std::terminate();
+        }
+    }
+
+    template <typename U = T>
+    requires(!SomeResult<std::decay_t<U>>) && std::is_constructible_v<T, U>
+    void return_value(U&& x) {  // NOLINT
+        result.emplace(std::in_place, std::forward<U>(x));
+    }
+
+    template <ConvertibleTo<ResultType> R>
+    void return_value(R&& x) {  // NOLINT
+        result.emplace(std::forward<R>(x));
+    }
+
+    template <typename G>
+    void returnError(G&& error) {
+        using E = typename ResultType::template StoredError<std::decay_t<G>>;
+        result.emplace(detail::pass_tag<E>, std::forward<G>(error));
+    }
+
+    // The frame stays suspended until the owning Task is destroyed. As in FinalAwaiter,
+    // an unwrapping awaiter is finished with the error rather than resumed.
+    std::coroutine_handle<> unwind() noexcept {
+        assert(result.has_value());
+
+        if (propagate != nullptr) {
+            return propagate(continuation, std::move(*result));
+        }
+        return continuation;
+    }
+
+    template <typename Promise>
+    static std::coroutine_handle<> propagateTo(std::coroutine_handle<> to, ResultType&& r) {
+        auto h = std::coroutine_handle<Promise>::from_address(to.address());
+        return ResultAwaitable<ResultType&&>{std::move(r)}.await_suspend(h);
+    }
+
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    Propagate propagate = nullptr;
+    std::optional<ResultType> result;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lazy asynchronous computation of a Result
+ *
+ * The task starts when awaited and resumes the awaiting coroutine by symmetric transfer,
+ * so long chains of tasks completing synchronously do not grow the stack. A Result coroutine
+ * runs to completion before returning, so it cannot await a Task.
+ * @code
+ * Task<Result<int, IoError>> read(Socket& s);
+ *
+ * Task<Result<int, IoError, ParseError>> handle(ThreadPool& pool, Socket& s) {
+ *     co_await schedule(pool);
+ *     int n = co_await read(s);           // IoError finishes handle() as well
+ *     auto r = co_await read(s).result(); // Result<int, IoError> as is
+ *     co_return n + co_await std::move(r);
+ * }
+ * @endcode
+ */
+template <typename T, typename... Es>
+class [[nodiscard]] Task<Result<T, Es...>> {
+ public:
+    using promise_type = detail::TaskPromise<T, Es...>;  // NOLINT
+    using ResultType = Result<T, Es...>;
+
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() noexcept {
+        reset();
+    }
+
+    // Yields the value, errors finish the awaiting task right away
+    auto operator co_await() && noexcept {
+        return Awaiter<true>{handle_};
+    }
+
+    // Yields the Result as is
+    auto result() && noexcept {
+        return Awaiter<false>{handle_};
+    }
+
+ private:
+    template <bool Unwrap>
+    struct Awaiter {
+        std::coroutine_handle<promise_type> handle;
+
+        bool await_ready() noexcept {  // NOLINT
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(  // NOLINT
+            std::coroutine_handle<Promise> caller) noexcept {
+            static_assert(!detail::IsResultPromise<Promise>,
+                          "a Result coroutine returns before a Task completes: "
+                          "make the caller a Task, or run the Task with syncWait()");
+
+            auto& promise = handle.promise();
+            promise.continuation = caller;
+
+            if constexpr (Unwrap) {
+                promise.propagate = &promise_type::template propagateTo<Promise>;
+            }
+
+            return handle;
+        }
+
+        std::conditional_t<Unwrap, T, ResultType> await_resume() {  // NOLINT
+            auto& result = handle.promise().result;
+            assert(result.has_value());
+
+            if constexpr (Unwrap) {
+                return std::move(*result).value();
+            } else {
+                return std::move(*result);
+            }
+        }
+    };
+
+    void reset() noexcept {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+}  // namespace result
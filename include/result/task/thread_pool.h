@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace result {
+
+/**
+ * @brief Thread pool executor with a queue per worker
+ *
+ * Every worker owns a mutex-guarded deque. Coroutines scheduled from a worker go to its own
+ * queue, others are spread round-robin. Idle workers take from the other queues before
+ * going to sleep. Scheduled coroutines are drained before the destructor returns.
+ */
+class ThreadPool {
+ public:
+    explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
+        : queues_(std::max<size_t>(num_threads, 1)) {
+        threads_.reserve(queues_.size());
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            threads_.emplace_back([this, i] { run(i); });
+        }
+    }
+
+    // Pinned
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    ~ThreadPool() noexcept {
+        {
+            std::lock_guard lock(mutex_);
+            stopped_ = true;
+        }
+        wakeup_.notify_all();
+        threads_.clear();
+    }
+
+    void execute(std::coroutine_handle<> h) {
+        size_t index = current_ == this ? current_index_
+                                        : next_.fetch_add(1, std::memory_order_relaxed);
+        Queue& queue = queues_[index % queues_.size()];
+
+        // Counted before the push, so a worker never sees the handle while pending_ is zero
+        pending_.fetch_add(1);
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.handles.push_back(h);
+        }
+
+        if (sleeping_.load() > 0) {
+            std::lock_guard lock(mutex_);
+            wakeup_.notify_one();
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return queues_.size();
+    }
+
+ private:
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<std::coroutine_handle<>> handles;
+    };
+
+    void run(size_t index) {
+        current_ = this;
+        current_index_ = index;
+
+        while (true) {
+            if (auto h = pop(index)) {
+                h.resume();
+                continue;
+            }
+
+            std::unique_lock lock(mutex_);
+            sleeping_.fetch_add(1);
+            wakeup_.wait(lock, [&] { return stopped_ || pending_.load() > 0; });
+            sleeping_.fetch_sub(1);
+
+            if (stopped_ && pending_.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    // Own queue first, then steal from the others
+    std::coroutine_handle<> pop(size_t index) {
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            Queue& queue = queues_[(index + i) % queues_.size()];
+            std::lock_guard lock(queue.mutex);
+
+            if (!queue.handles.empty()) {
+                auto h = queue.handles.front();
+                queue.handles.pop_front();
+                pending_.fetch_sub(1);
+                return h;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static inline thread_local ThreadPool* current_ = nullptr;
+    static inline thread_local size_t current_index_ = 0;
+
+    std::vector<Queue> queues_;
+    std::atomic<size_t> next_{0};
+
+    // Dekker-style handshake between execute() and sleeping workers, both sequentially consistent
+    std::atomic<int64_t> pending_{0};
+    std::atomic<int64_t> sleeping_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool stopped_ = false;
+
+    std::vector<std::jthread> threads_;
+};
+
+}  // namespace result
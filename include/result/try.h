@@ -0,0 +1,91 @@
+#pragma once
+
+#include "result/detail/overloaded.h"
+#include "result/result.h"
+#include "result/traits.h"
+
+#include <cassert>
+#include <utility>
+
+namespace result::detail {
+
+// Converts into any Result that can hold every error of R, constructing the error
+// right in the returned object. The value of R must have been checked to be absent.
+template <typename R>
+class [[nodiscard]] ErrorPropagator {
+    using From = std::decay_t<R>;
+
+ public:
+    explicit ErrorPropagator(R from) noexcept : from_(std::forward<R>(from)) {}
+
+    template <typename U, typename... Gs>
+    requires ConvertibleTo<typename From::template RebindValue<Impossible>, Result<U, Gs...>>
+    operator Result<U, Gs...>() && {  // NOLINT
+        using To = Result<U, Gs...>;
+        assert(from_.hasAnyError());
+
+        return std::forward<R>(from_).taggedVisit(detail::Overloaded{
+            [](val_tag_t, auto&&) -> To { std::unreachable(); },
+            []<typename G>(G&& error) -> To {
+                using E = typename To::template StoredError<std::decay_t<G>>;
+                return To(detail::pass_tag<E>, std::forward<G>(error));
+            },
+        });
+    }
+
+ private:
+    R from_;
+};
+
+template <typename R>
+requires SomeResult<std::decay_t<R>>
+ErrorPropagator<R&&> propagateError(R&& from) noexcept {
+    return ErrorPropagator<R&&>(std::forward<R>(from));
+}
+
+}  // namespace result::detail
+
+#define RESULT_TRY_CONCAT_IMPL(a, b) a##b
+#define RESULT_TRY_CONCAT(a, b) RESULT_TRY_CONCAT_IMPL(a, b)
+
+#define RESULT_TRY_ASSIGN_IMPL(tmp, var, ...)                                      \
+    auto&& tmp = (__VA_ARGS__);                                                    \
+    if (!tmp) [[unlikely]] {                                                       \
+        return ::result::detail::propagateError(std::forward<decltype(tmp)>(tmp)); \
+    }                                                                              \
+    var = std::forward<decltype(tmp)>(tmp).value()
+
+/**
+ * @brief Unwrap the value of a Result or return its error from the enclosing function
+ *
+ * The enclosing function must return a Result that can hold every error of the expression:
+ * @code
+ * Result<int, ParseError> parse(std::string_view s);
+ *
+ * Result<Config, ParseError, IoError> load(std::string_view s) {
+ *     int port = RESULT_TRY(parse(s));
+ *     ...
+ * }
+ * @endcode
+ * Unlike co_await, no coroutine frame is involved. Relies on GNU statement expressions.
+ */
+#define RESULT_TRY(...)                                                    \
+    __extension__({                                                        \
+        auto&& result_try_tmp_ = (__VA_ARGS__);                            \
+        if (!result_try_tmp_) [[unlikely]] {                               \
+            return ::result::detail::propagateError(                       \
+                std::forward<decltype(result_try_tmp_)>(result_try_tmp_)); \
+        }                                                                  \
+        std::forward<decltype(result_try_tmp_)>(result_try_tmp_).value();  \
+    })
+
+/**
+ * @brief Portable statement form of RESULT_TRY, which also allows binding references
+ *
+ * @code
+ * RESULT_TRY_ASSIGN(auto&& config, load(s));
+ * RESULT_TRY_ASSIGN(port, parse(s));
+ * @endcode
+ */
+#define RESULT_TRY_ASSIGN(var, ...)                                                           \
+    RESULT_TRY_ASSIGN_IMPL(RESULT_TRY_CONCAT(result_try_tmp_, __COUNTER__), var, __VA_ARGS__)
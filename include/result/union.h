@@ -3,6 +3,8 @@
 #include "result/detail/apply_to_template.h"
 #include "result/result.h"
 
+#include <type_traits>
+
 namespace result {
 
 namespace detail {
@@ -17,6 +19,24 @@ struct ErrorTypesFor<Result<V, Es...>> {
     using type = tl::List<Es...>;
 };
 
+// Drops the errors some other error of the list wraps, e.g. E next to Shared<E>
+template <typename Errors>
+struct NotWrapped;
+
+template <typename... Es>
+struct NotWrapped<tl::List<Es...>> {
+    template <typename G>
+    static constexpr bool test() noexcept {
+        return !((!std::is_same_v<Es, G> && std::is_same_v<ErrorPayloadOf<Es>, G>) || ...);
+    }
+};
+
+template <typename... VoEOrErrorTypes>
+struct UnionErrors {
+    using Errors = tl::Unite<typename ErrorTypesFor<VoEOrErrorTypes>::type...>;
+    using type = tl::Filter<NotWrapped<Errors>, Errors>;
+};
+
 }  // namespace detail
 
 /**
@@ -33,10 +53,11 @@ struct ErrorTypesFor<Result<V, Es...>> {
  * using C = Union<float, A, B>;
  * static_assert(std::is_same_v<C, Result<float, int, short, long>>);
  * @endcode
+ * An error and its wrapper, e.g. E and Shared<E>, are merged into the wrapper.
  */
 template <typename ValueType, typename... VoEOrErrorTypes>
 using Union = detail::ApplyToTemplate<
     Result,
-    tl::PushFront<tl::Unite<typename detail::ErrorTypesFor<VoEOrErrorTypes>::type...>, ValueType>>;
+    tl::PushFront<typename detail::UnionErrors<VoEOrErrorTypes...>::type, ValueType>>;
 
 }  // namespace result
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "result/detail/overloaded.h"
+#include "result/error/validation_errors.h"
+#include "result/result.h"
+#include "result/traits.h"
+#include "result/union.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+namespace detail {
+
+template <size_t Capacity, typename Errors>
+struct ValidationErrorsFor;
+
+template <size_t Capacity, typename... Es>
+struct ValidationErrorsFor<Capacity, tl::List<Es...>> {
+    using type = ValidationErrors<Capacity, Es...>;
+};
+
+}  // namespace detail
+
+template <size_t Capacity, typename... Rs>
+using ValidationErrorsOf = typename detail::ValidationErrorsFor<
+    Capacity,
+    ErrorTypesOf<Union<detail::Impossible, Rs...>>>::type;
+
+/**
+ * @brief Combines Results without short-circuiting, collecting every error
+ *
+ * Unlike andThen, all arguments are inspected, and the errors of all of them end up in
+ * ValidationErrors stored inline, so a bad request costs no allocation:
+ * @code
+ * Result<Name, TooLong, Empty> name = checkName(request);
+ * Result<Age, OutOfRange> age = checkAge(request);
+ *
+ * auto user = validateAll(std::move(name), std::move(age));
+ * // Result<std::tuple<Name, Age>, ValidationErrors<8, TooLong, Empty, OutOfRange>>
+ * @endcode
+ * Errors beyond Capacity are counted, see ValidationErrors::overflow().
+ */
+template <size_t Capacity = 8, typename... Rs>
+requires(SomeResult<std::decay_t<Rs>> && ...)
+auto validateAll(Rs&&... rs) {
+    using Errors = ValidationErrorsOf<Capacity, std::decay_t<Rs>...>;
+    using Ret = Result<std::tuple<ValueTypeOf<std::decay_t<Rs>>...>, Errors>;
+
+    Errors errors;
+    (std::forward<Rs>(rs).taggedVisit(detail::Overloaded{
+         [](val_tag_t, auto&&) {},
+         [&]<typename G>(G&& error) { errors.add(std::forward<G>(error)); },
+     }),
+     ...);
+
+    if (!errors.empty()) {
+        return Ret(makeError(std::move(errors)));
+    }
+    return Ret(std::in_place, std::forward<Rs>(rs).value()...);
+}
+
+}  // namespace result
@@ -0,0 +1,4 @@
+#pragma once
+
+#include "result/wire/codec.h"
+#include "result/wire/encode.h"
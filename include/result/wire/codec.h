@@ -0,0 +1,186 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace result::wire {
+
+/**
+ * @brief Opts a trivially copyable T into being copied onto the wire byte for byte
+ *
+ * Only for types whose bytes mean the same in another process: no pointers, no views,
+ * no padding, and the byte order of the host. Arithmetic and enum types need no opt-in.
+ * @code
+ * template <>
+ * struct result::wire::RawBytes<Header> : std::true_type {};
+ * @endcode
+ */
+template <typename T>
+struct RawBytes : std::false_type {};
+
+namespace detail {
+
+template <size_t N>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1> {
+    using type = uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2> {
+    using type = uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4> {
+    using type = uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8> {
+    using type = uint64_t;
+};
+
+// Encoded little-endian whatever the host
+template <typename T>
+concept Scalar = (std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+                 requires { typename UnsignedOfSize<sizeof(T)>::type; };
+
+template <typename T>
+concept Copied = Scalar<T> || (std::is_trivially_copyable_v<T> && RawBytes<T>::value);
+
+// Converts between the byte order of the host and that of the wire, both ways
+template <typename T>
+T wireOrder(T x) noexcept {
+    if constexpr (Scalar<T> && std::endian::native != std::endian::little) {
+        using Bits = typename UnsignedOfSize<sizeof(T)>::type;
+        return std::bit_cast<T>(std::byteswap(std::bit_cast<Bits>(x)));
+    } else {
+        return x;
+    }
+}
+
+}  // namespace detail
+
+// Zero-copy view of a scalar or RawBytes T in a byte buffer, which need not be aligned
+template <typename T>
+requires detail::Copied<T>
+class Ref {
+ public:
+    Ref() = default;
+
+    explicit Ref(const std::byte* data) noexcept : data_(data) {}
+
+    [[nodiscard]] T load() const noexcept {
+        std::array<std::byte, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), data_, sizeof(T));
+
+        // Any byte from the wire is a valid bool
+        if constexpr (std::is_same_v<T, bool>) {
+            return bytes[0] != std::byte{0};
+        } else {
+            return detail::wireOrder(std::bit_cast<T>(bytes));
+        }
+    }
+
+    T operator*() const noexcept {
+        return load();
+    }
+
+    [[nodiscard]] const std::byte* data() const noexcept {
+        return data_;
+    }
+
+ private:
+    const std::byte* data_ = nullptr;
+};
+
+/**
+ * @brief Wire representation of T, specialize to plug in other types
+ *
+ * A codec provides:
+ * @code
+ * using View = ...;  // what decode() gives, preferably referring to the input buffer
+ * static std::optional<size_t> size(const T& x);  // bytes written by encode(x), if encodable
+ * static std::byte* encode(const T& x, std::byte* out);  // returns the end of written bytes
+ * static std::optional<View> decode(std::span<const std::byte>& in);  // consumes bytes of `in`
+ * @endcode
+ * Arithmetic and enum types are copied little-endian, RawBytes types as they are.
+ */
+template <typename T>
+struct Codec;
+
+template <detail::Copied T>
+struct Codec<T> {
+    using View = Ref<T>;
+
+    static std::optional<size_t> size(const T&) noexcept {
+        return sizeof(T);
+    }
+
+    static std::byte* encode(const T& x, std::byte* out) noexcept {
+        const T ordered = detail::wireOrder(x);
+        std::memcpy(out, &ordered, sizeof(T));
+        return out + sizeof(T);
+    }
+
+    static std::optional<View> decode(std::span<const std::byte>& in) noexcept {
+        if (in.size() < sizeof(T)) {
+            return std::nullopt;
+        }
+
+        View view(in.data());
+        in = in.subspan(sizeof(T));
+        return view;
+    }
+};
+
+// Length-prefixed characters, decoded as a view into the buffer.
+// Strings longer than the prefix can tell cannot be encoded.
+template <>
+struct Codec<std::string> {
+    using View = std::string_view;
+    using Length = uint32_t;
+
+    static std::optional<size_t> size(const std::string& x) noexcept {
+        if (x.size() > std::numeric_limits<Length>::max()) {
+            return std::nullopt;
+        }
+        return sizeof(Length) + x.size();
+    }
+
+    static std::byte* encode(const std::string& x, std::byte* out) noexcept {
+        assert(x.size() <= std::numeric_limits<Length>::max());
+        out = Codec<Length>::encode(static_cast<Length>(x.size()), out);
+        std::memcpy(out, x.data(), x.size());
+        return out + x.size();
+    }
+
+    static std::optional<View> decode(std::span<const std::byte>& in) noexcept {
+        auto length = Codec<Length>::decode(in);
+        if (!length.has_value() || in.size() < **length) {
+            return std::nullopt;
+        }
+
+        View view(reinterpret_cast<const char*>(in.data()), **length);  // NOLINT
+        in = in.subspan(**length);
+        return view;
+    }
+};
+
+template <typename T>
+using ViewOf = typename Codec<T>::View;
+
+}  // namespace result::wire
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "result/detail/min_sized_type.h"
+#include "result/detail/overloaded.h"
+#include "result/result.h"
+#include "result/traits.h"
+#include "result/wire/codec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace result::wire {
+
+struct DecodeError {
+    enum Reason : uint8_t {
+        Truncated,
+        BadIndex,
+    };
+
+    Reason reason;
+    size_t offset = 0;  // from the start of the decoded input
+};
+
+struct EncodeError {
+    enum Reason : uint8_t {
+        TooLarge,  // for its codec, e.g. a string longer than its length prefix can tell
+    };
+
+    Reason reason;
+    size_t index = 0;  // of the Result in a batch
+};
+
+namespace detail {
+
+template <typename R>
+struct ResultCodec;
+
+template <typename V, typename... Es>
+struct ResultCodec<Result<V, Es...>> {
+    // Same alternatives as the encoded Result, viewed through their codecs
+    using View = Result<ViewOf<V>, ViewOf<Es>...>;
+    using Index = ::result::detail::MinimalSizedIndexType<1 + sizeof...(Es)>;
+
+    static std::optional<size_t> size(const Result<V, Es...>& r) {
+        const std::optional<size_t> payload = r.taggedVisit(::result::detail::Overloaded{
+            [](val_tag_t, const V& value) { return Codec<V>::size(value); },
+            []<typename E>(const E& error) { return Codec<E>::size(error); },
+        });
+
+        if (!payload.has_value()) {
+            return std::nullopt;
+        }
+        return sizeof(Index) + *payload;
+    }
+
+    static std::byte* encode(const Result<V, Es...>& r, std::byte* out) {
+        out = Codec<Index>::encode(static_cast<Index>(r.index()), out);
+
+        return r.taggedVisit(::result::detail::Overloaded{
+            [&](val_tag_t, const V& value) { return Codec<V>::encode(value, out); },
+            [&]<typename E>(const E& error) { return Codec<E>::encode(error, out); },
+        });
+    }
+
+    static Result<View, DecodeError> decode(std::span<const std::byte>& in) {
+        auto rest = in;
+
+        auto index = Codec<Index>::decode(rest);
+        if (!index.has_value()) {
+            return makeError(DecodeError{DecodeError::Truncated});
+        }
+        if (**index > sizeof...(Es)) {
+            return makeError(DecodeError{DecodeError::BadIndex});
+        }
+
+        auto view = Decoders[**index](rest);
+        if (!view.has_value()) {
+            return makeError(DecodeError{DecodeError::Truncated});
+        }
+
+        in = rest;
+        return Result<View, DecodeError>(std::in_place, std::move(*view));
+    }
+
+ private:
+    using Decoder = std::optional<View> (*)(std::span<const std::byte>&);
+
+    static std::optional<View> decodeValue(std::span<const std::byte>& in) {
+        auto value = Codec<V>::decode(in);
+        if (!value.has_value()) {
+            return std::nullopt;
+        }
+        return View(std::in_place, *value);
+    }
+
+    template <typename E>
+    static std::optional<View> decodeError(std::span<const std::byte>& in) {
+        auto error = Codec<E>::decode(in);
+        if (!error.has_value()) {
+            return std::nullopt;
+        }
+        return View(::result::detail::pass_tag<ViewOf<E>>, *error);
+    }
+
+    static constexpr Decoder Decoders[] = {&decodeValue, &decodeError<Es>...};
+};
+
+}  // namespace detail
+
+// Result<V, Es...> decoded as Result<ViewOf<V>, ViewOf<Es>...>, error views must be distinct
+template <SomeResult R>
+using View = typename detail::ResultCodec<R>::View;
+
+// Bytes written by encode(r): the alternative index of the minimal width and the payload.
+// Fails if the payload cannot be encoded, encode() must not be called then.
+template <SomeResult R>
+Result<size_t, EncodeError> encodedSize(const R& r) {
+    if (auto size = detail::ResultCodec<R>::size(r)) {
+        return *size;
+    }
+    return makeError(EncodeError{EncodeError::TooLarge});
+}
+
+// `out` must have room for encodedSize(r) bytes, returns the end of the written ones
+template <SomeResult R>
+std::byte* encode(const R& r, std::byte* out) {
+    return detail::ResultCodec<R>::encode(r, out);
+}
+
+// Decodes one Result from the front of `in` and consumes its bytes, `in` is intact on errors
+template <SomeResult R>
+Result<View<R>, DecodeError> decode(std::span<const std::byte>& in) {
+    return detail::ResultCodec<R>::decode(in);
+}
+
+template <SomeResult R>
+Result<size_t, EncodeError> encodedSize(std::span<const R> rs) {
+    size_t size = 0;
+    for (size_t i = 0; i < rs.size(); ++i) {
+        auto one = detail::ResultCodec<R>::size(rs[i]);
+        if (!one.has_value()) {
+            return makeError(EncodeError{EncodeError::TooLarge, i});
+        }
+        size += *one;
+    }
+    return size;
+}
+
+// Encodes Results back to back, `out` must have room for encodedSize(rs) bytes
+template <SomeResult R>
+std::byte* encodeBatch(std::span<const R> rs, std::byte* out) {
+    for (const R& r : rs) {
+        out = encode(r, out);
+    }
+    return out;
+}
+
+// Decodes Results until `in` is exhausted, passing each View<R> to `consume`
+template <SomeResult R, typename F>
+Result<size_t, DecodeError> decodeBatch(std::span<const std::byte> in, F&& consume) {
+    const size_t total = in.size();
+    size_t count = 0;
+
+    while (!in.empty()) {
+        auto view = decode<R>(in);
+        if (view.hasAnyError()) {
+            const auto reason = view.template error<DecodeError>().reason;
+            return makeError(DecodeError{reason, total - in.size()});
+        }
+
+        consume(std::move(view).value());
+        ++count;
+    }
+
+    return count;
+}
+
+}  // namespace result::wire
@@ -0,0 +1,58 @@
+#include "./budget.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions to count allocations for EXPECT_BUDGET.
+// The array and nothrow forms call these ones.
+
+namespace {
+
+std::atomic<size_t> allocations_{0};  // NOLINT
+
+void* allocate(size_t size, size_t alignment) {
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        ptr = std::malloc(size == 0 ? 1 : size);
+    } else {
+        ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+}  // namespace
+
+size_t test::allocations() noexcept {
+    return allocations_.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size) {
+    return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
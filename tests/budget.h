@@ -0,0 +1,123 @@
+#pragma once
+
+#include "./remember_op.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <sstream>
+
+namespace test {
+
+// Calls of the global operator new so far, on any thread, see budget.cpp
+size_t allocations() noexcept;
+
+// What an expression cost: allocations, and moves and copies of RememberLastOp objects
+struct Usage {
+    size_t allocs = 0;
+    size_t moves = 0;
+    size_t copies = 0;
+
+    static Usage now() noexcept {
+        auto count = [](auto... types) { return (OpCollector::count(types) + ...); };
+        return Usage{
+            .allocs = allocations(),
+            .moves = count(CONSTRUCT_MOVE, CONSTRUCT_MOVE_CONST, ASSIGN_MOVE, ASSIGN_MOVE_CONST),
+            .copies = count(CONSTRUCT_COPY, CONSTRUCT_COPY_CONST, ASSIGN_COPY, ASSIGN_COPY_CONST),
+        };
+    }
+};
+
+template <typename F>
+Usage measure(F&& f) {
+    const Usage before = Usage::now();
+    f();
+    const Usage after = Usage::now();
+
+    return Usage{
+        .allocs = after.allocs - before.allocs,
+        .moves = after.moves - before.moves,
+        .copies = after.copies - before.copies,
+    };
+}
+
+namespace budget {
+
+enum class Metric { Allocs, Moves, Copies };
+
+struct Limit {
+    Metric metric;
+    bool exact;
+    size_t value;
+};
+
+// The names usable in EXPECT_BUDGET: `allocs = 0` is an exact limit, `moves <= 2` an upper one
+struct Name {
+    Metric metric;
+
+    Limit operator=(size_t value) const noexcept {  // NOLINT
+        return Limit{metric, true, value};
+    }
+
+    friend Limit operator<=(Name name, size_t value) noexcept {
+        return Limit{name.metric, false, value};
+    }
+};
+
+inline const char* toString(Metric metric) noexcept {
+    switch (metric) {
+        case Metric::Allocs:
+            return "allocs";
+        case Metric::Moves:
+            return "moves";
+        case Metric::Copies:
+            return "copies";
+    }
+    return "?";
+}
+
+inline testing::AssertionResult check(const char* expr,
+                                      const Usage& usage,
+                                      std::initializer_list<Limit> limits) {
+    std::ostringstream failures;
+    for (const Limit& limit : limits) {
+        const size_t used = limit.metric == Metric::Allocs  ? usage.allocs
+                            : limit.metric == Metric::Moves ? usage.moves
+                                                            : usage.copies;
+        if (limit.exact ? used != limit.value : used > limit.value) {
+            failures << "\n\t" << toString(limit.metric) << (limit.exact ? " = " : " <= ")
+                     << limit.value << ", used " << used;
+        }
+    }
+
+    if (failures.tellp() == 0) {
+        return testing::AssertionSuccess();
+    }
+    return testing::AssertionFailure() << "Budget exceeded by " << expr << failures.str();
+}
+
+}  // namespace budget
+
+}  // namespace test
+
+/**
+ * Evaluates `expr` once, destroying its result, and checks what it cost:
+ * @code
+ * EXPECT_BUDGET(std::move(r) | map(f), allocs = 0, moves <= 6, copies = 0);
+ * @endcode
+ * Moves and copies are those of test::RememberLastOp objects, allocations are counted
+ * on all threads. Parenthesize expressions with top-level commas. The names of the limits
+ * are only bound in the limit list, `expr` sees the caller's variables of those names.
+ */
+#define EXPECT_BUDGET(expr, ...)                                                                  \
+    do {                                                                                          \
+        const ::test::Usage expect_budget_usage_ =                                                \
+            ::test::measure([&] { static_cast<void>(expr); });                                    \
+        EXPECT_TRUE(([&] {                                                                        \
+            [[maybe_unused]] const ::test::budget::Name allocs{::test::budget::Metric::Allocs};   \
+            [[maybe_unused]] const ::test::budget::Name moves{::test::budget::Metric::Moves};     \
+            [[maybe_unused]] const ::test::budget::Name copies{::test::budget::Metric::Copies};   \
+            return ::test::budget::check(#expr, expect_budget_usage_, {__VA_ARGS__});             \
+        }()));                                                                                    \
+    } while (false)
@@ -0,0 +1,29 @@
+#include "result/combine/erase_errors.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+
+#include <gtest/gtest.h>
+
+namespace result {
+
+TEST(EraseErrors, ValueOk) {
+    auto r = Result<int, int, std::string>(2);
+    auto u = r | eraseErrors();
+    static_assert(std::is_same_v<decltype(u), Result<int, AnyError>>);
+    EXPECT_EQ(*u, 2);
+}
+
+TEST(EraseErrors, ValueErr) {
+    auto r = Result<int, int, std::string>(makeError<std::string>("hello"));
+    auto u = r | eraseErrors();
+    EXPECT_TRUE(u.hasAnyError());
+    EXPECT_TRUE(u.error<AnyError>().is<std::string>());
+    EXPECT_EQ(u.error<AnyError>().as<std::string>(), "hello");
+}
+
+TEST(EraseErrors, AlreadyErased) {
+    auto r = Result<int, AnyError, int>(makeError(AnyError(1)));
+    auto u = r | eraseErrors();
+    EXPECT_EQ(u.error<AnyError>().as<int>(), 1);
+}
+
+}  // namespace result
@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+
 namespace result {
 
 TEST(MapErr, ValueErr) {
@@ -52,4 +54,21 @@ TEST(MapErr, ValueMultiMapOk) {
     EXPECT_EQ(*u, 2);
 }
 
+TEST(MapErr, Allocator) {
+    std::pmr::monotonic_buffer_resource resource;
+    std::pmr::polymorphic_allocator<> alloc(&resource);
+    std::string text = "a message that does not fit into the small string buffer";
+
+    auto r = Result<int, int>(makeError(2));
+    auto u = r | mapErr(std::allocator_arg, alloc, [&](int) { return std::pmr::string(text); });
+    static_assert(std::is_same_v<decltype(u), Result<int, std::pmr::string>>);
+    EXPECT_EQ(u.error<std::pmr::string>(), text);
+    EXPECT_EQ(u.error<std::pmr::string>().get_allocator().resource(), &resource);
+
+    auto v = r | mapErr(std::allocator_arg, alloc, [&](int, const auto& a) {
+                 return std::pmr::string(text, a);
+             });
+    EXPECT_EQ(v.error<std::pmr::string>().get_allocator().resource(), &resource);
+}
+
 }  // namespace result
@@ -0,0 +1,92 @@
+#include "result/error/any_error.h"
+
+#include "../remember_op.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace result {
+
+struct NotFound {
+    int key = 0;
+};
+
+struct Huge {
+    std::array<char, 128> data{};
+};
+
+struct alignas(16) Aligned {
+    int value = 0;
+};
+
+static_assert(sizeof(AnyError) <= 4 * sizeof(void*));
+static_assert(AnyError::StoredInline<NotFound>);
+static_assert(AnyError::StoredInline<std::string>);
+static_assert(!AnyError::StoredInline<Huge>);
+static_assert(!AnyError::StoredInline<Aligned>);
+
+TEST(AnyError, Query) {
+    AnyError e = NotFound{42};
+
+    EXPECT_TRUE(e.is<NotFound>());
+    EXPECT_FALSE(e.is<std::string>());
+    EXPECT_EQ(e.as<NotFound>().key, 42);
+    EXPECT_EQ(e.tryAs<NotFound>()->key, 42);
+    EXPECT_EQ(e.tryAs<std::string>(), nullptr);
+}
+
+TEST(AnyError, OverAligned) {
+    AnyError e = Aligned{7};
+    AnyError moved = std::move(e);
+
+    const auto address = reinterpret_cast<uintptr_t>(&moved.as<Aligned>());
+    EXPECT_EQ(address % alignof(Aligned), 0);
+    EXPECT_EQ(moved.as<Aligned>().value, 7);
+}
+
+TEST(AnyError, Heap) {
+    Huge huge;
+    huge.data[1] = 'x';
+    AnyError e = huge;
+    AnyError copy = e;
+    AnyError moved = std::move(e);
+
+    EXPECT_FALSE(e.is<Huge>());  // NOLINT
+    EXPECT_EQ(copy.as<Huge>().data[1], 'x');
+    EXPECT_EQ(moved.as<Huge>().data[1], 'x');
+}
+
+TEST(AnyError, Assign) {
+    AnyError e = std::string("hello");
+    AnyError other = NotFound{1};
+
+    e = other;
+    EXPECT_TRUE(e.is<NotFound>());
+
+    other = std::string("world");
+    e = std::move(other);
+    EXPECT_EQ(e.as<std::string>(), "world");
+}
+
+TEST(AnyError, Ops) {
+    using E = test::RememberLastOp<1>;
+
+    test::OpCollector collector;
+    {
+        AnyError e = E{};
+        AnyError moved = std::move(e);
+    }
+
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1),
+        test::Op(test::Destroy, 1)));
+}
+
+}  // namespace result
@@ -0,0 +1,113 @@
+#include "result/combine/map_err.h"
+#include "result/error/formatted.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <format>
+#include <string>
+
+namespace result {
+
+// Counts how many times it was formatted
+struct Counted {
+    int value = 0;
+    static inline int formatted = 0;
+};
+
+}  // namespace result
+
+template <>
+struct std::formatter<result::Counted> : std::formatter<int> {
+    auto format(const result::Counted& c, std::format_context& ctx) const {
+        ++result::Counted::formatted;
+        return std::formatter<int>::format(c.value, ctx);
+    }
+};
+
+namespace result {
+
+struct NotFound {
+    const char* message() const {
+        return "not found";
+    }
+};
+
+struct Opaque {};
+
+using LookupError = FormattedError<std::string, Counted>;
+
+Result<int, LookupError> lookup(const std::string& key, int at) {
+    if (at < 0) {
+        return makeError(FormattedError("no {} at {}", key, Counted{at}));
+    }
+    return at;
+}
+
+TEST(FormattedError, Message) {
+    const FormattedError error("{} + {} = {}", 1, 2, std::string("three"));
+    EXPECT_EQ(error.message(), "1 + 2 = three");
+    EXPECT_EQ(error.format(), "{} + {} = {}");
+    EXPECT_EQ(std::format("[{}]", error), "[1 + 2 = three]");
+}
+
+TEST(FormattedError, Deferred) {
+    Counted::formatted = 0;
+
+    auto r = lookup("key", -1);
+    ASSERT_TRUE(r.hasAnyError());
+    EXPECT_EQ(Counted::formatted, 0);
+
+    // Handling the error without its message never formats it
+    EXPECT_EQ(r.valueOr(0), 0);
+    EXPECT_EQ(Counted::formatted, 0);
+
+    EXPECT_EQ(r.error<LookupError>().message(), "no key at -1");
+    EXPECT_EQ(Counted::formatted, 1);
+}
+
+TEST(FormattedError, OwnsArguments) {
+    auto make = [] {
+        std::string key = "temporary";
+        return FormattedError("key {}", key);
+    };
+    EXPECT_EQ(make().message(), "key temporary");
+}
+
+TEST(ContextError, WithContext) {
+    Counted::formatted = 0;
+
+    auto r = lookup("key", -1) | mapErr(withContext("reading block {}", Counted{7}));
+    EXPECT_EQ(Counted::formatted, 0);
+
+    using Error = ContextError<LookupError, Counted>;
+    ASSERT_TRUE(r.hasError<Error>());
+    EXPECT_EQ(r.error<Error>().cause().format(), "no {} at {}");
+    EXPECT_EQ(r.error<Error>().message(), "reading block 7: no key at -1");
+    EXPECT_EQ(Counted::formatted, 2);
+}
+
+TEST(ContextError, Causes) {
+    Result<int, NotFound, int, Opaque> r = makeError(NotFound{});
+    auto ctx = withContext("opening {}", "config");
+
+    auto message = [&]<typename E>(auto r) {
+        return (r | mapErr(ctx)).template error<ContextError<E, const char*>>().message();
+    };
+
+    EXPECT_EQ(message.operator()<NotFound>(r), "opening config: not found");
+
+    r = makeError(42);
+    EXPECT_EQ(message.operator()<int>(r), "opening config: 42");
+
+    r = makeError(Opaque{});
+    EXPECT_EQ(message.operator()<Opaque>(r), "opening config: result::Opaque");
+}
+
+TEST(ContextError, Value) {
+    auto r = lookup("key", 3) | mapErr(withContext("unused {}", 1));
+    EXPECT_EQ(*r, 3);
+}
+
+}  // namespace result
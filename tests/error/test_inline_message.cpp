@@ -0,0 +1,46 @@
+#include "result/error/inline_message.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+namespace result {
+
+using Message = InlineMessage<15>;
+
+static_assert(sizeof(Message) == 17);
+static_assert(std::is_trivially_copyable_v<Message>);
+static_assert(sizeof(InlineMessage<300>) == 304);
+
+TEST(InlineMessage, Fits) {
+    Result<int, Message> r = makeError(Message("not found"));
+
+    EXPECT_EQ(r.error<Message>().message(), "not found");
+    EXPECT_EQ(r.error<Message>().size(), 9U);
+    EXPECT_FALSE(r.error<Message>().truncated());
+}
+
+TEST(InlineMessage, Truncates) {
+    Message m("a message that does not fit");
+
+    EXPECT_EQ(m.message(), "a message that ");
+    EXPECT_EQ(m.size(), Message::capacity());
+    EXPECT_TRUE(m.truncated());
+}
+
+TEST(InlineMessage, Append) {
+    Message m("key ");
+    m.append("foo").append(" not found");
+
+    EXPECT_EQ(m.message(), "key foo not fou");
+    EXPECT_TRUE(m.truncated());
+}
+
+TEST(InlineMessage, Constexpr) {
+    constexpr Message m("hello");
+    static_assert(m.message() == "hello");
+    static_assert(m == Message("hello"));
+}
+
+}  // namespace result
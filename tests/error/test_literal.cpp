@@ -0,0 +1,35 @@
+#include "result/error/literal.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+namespace result {
+
+static_assert(sizeof(LiteralError) == sizeof(const char*));
+static_assert(std::is_trivially_copyable_v<LiteralError>);
+static_assert(sizeof(Result<int, LiteralError>) == 2 * sizeof(const char*));
+
+Result<int, LiteralError> parse(int x) {
+    if (x < 0) {
+        return makeError(LiteralError("negative"));
+    }
+    return x;
+}
+
+TEST(LiteralError, Message) {
+    auto r = parse(-1);
+    EXPECT_TRUE(r.hasError<LiteralError>());
+    EXPECT_EQ(r.error<LiteralError>().message(), "negative");
+    EXPECT_STREQ(r.error<LiteralError>().c_str(), "negative");
+}
+
+TEST(LiteralError, Equality) {
+    constexpr LiteralError a("negative");
+    static_assert(a == LiteralError("negative"));
+    static_assert(a != LiteralError("positive"));
+    EXPECT_EQ(parse(-1).error<LiteralError>(), a);
+}
+
+}  // namespace result
@@ -0,0 +1,119 @@
+#include "../budget.h"
+#include "../remember_op.h"
+
+#include "result/combine/map_err.h"
+#include "result/combine/or_else.h"
+#include "result/detail/overloaded.h"
+#include "result/error/shared.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+#include "result/union.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace result {
+
+using Heavy = test::RememberLastOp<1>;
+
+struct FetchError {
+    std::string url;
+    int status = 0;
+
+    std::string message() const {
+        return url + ": " + std::to_string(status);
+    }
+};
+
+struct Retry {};
+
+static_assert(sizeof(Shared<FetchError>) == sizeof(void*));
+static_assert(isTriviallyRelocatable<Shared<FetchError>>);
+
+TEST(Shared, CopiesShareThePayload) {
+    Result<int, Shared<Heavy>> r = makeError(Shared(Heavy()));
+    const Heavy* payload = &r.error<Shared<Heavy>>().get();
+
+    std::vector<Result<int, Shared<Heavy>>> waiters;
+    waiters.reserve(16);
+    EXPECT_BUDGET(waiters.assign(16, r), allocs = 0, moves = 0, copies = 0);
+
+    EXPECT_EQ(r.error<Shared<Heavy>>().useCount(), 17);
+    for (const auto& w : waiters) {
+        EXPECT_EQ(&w.error<Shared<Heavy>>().get(), payload);
+    }
+
+    waiters.clear();
+    EXPECT_EQ(r.error<Shared<Heavy>>().useCount(), 1);
+}
+
+TEST(Shared, Message) {
+    const Shared error(FetchError{"/index", 503});
+    EXPECT_EQ(error.message(), "/index: 503");
+    EXPECT_EQ(error->status, 503);
+
+    const Shared<FetchError> in_place(std::in_place, "/", 404);
+    EXPECT_EQ((*in_place).url, "/");
+}
+
+TEST(Shared, ConcurrentCopies) {
+    Result<int, Shared<FetchError>> r = makeError(Shared(FetchError{"/", 500}));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([r] {
+            for (int i = 0; i < 10'000; ++i) {
+                auto copy = r;
+                EXPECT_EQ(copy.error<Shared<FetchError>>()->status, 500);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(r.error<Shared<FetchError>>().useCount(), 1);
+}
+
+TEST(Shared, HandlersSeeThePayload) {
+    Result<int, Shared<FetchError>, Retry> r = makeError(Shared(FetchError{"/", 500}));
+
+    auto mapped = r | mapErr(detail::Overloaded{
+                          [](const FetchError& e) { return e.status; },
+                          [](Retry) { return Retry{}; },
+                      });
+    static_assert(std::is_same_v<decltype(mapped), Result<int, int, Retry>>);
+    EXPECT_EQ(mapped.error<int>(), 500);
+
+    auto recovered = r | orElse([](const auto& e) -> Result<int, Retry> {
+                         if constexpr (std::is_same_v<std::decay_t<decltype(e)>, FetchError>) {
+                             return e.status;
+                         } else {
+                             return makeError(e);
+                         }
+                     });
+    EXPECT_EQ(*recovered, 500);
+}
+
+TEST(Shared, Conversions) {
+    using Plain = Result<int, FetchError>;
+    using Wrapped = Result<int, Shared<FetchError>, Retry>;
+
+    static_assert(std::is_same_v<Union<int, Plain, Wrapped>, Wrapped>);
+    static_assert(std::is_same_v<Union<int, Wrapped, Plain>, Wrapped>);
+
+    Plain plain = makeError(FetchError{"/a", 404});
+    Wrapped wrapped = plain;
+    EXPECT_EQ(wrapped.error<Shared<FetchError>>()->url, "/a");
+
+    wrapped = Plain(makeError(FetchError{"/b", 410}));
+    EXPECT_EQ(wrapped.error<Shared<FetchError>>()->status, 410);
+
+    Result<int, FetchError, Retry> copied_out = wrapped;
+    EXPECT_EQ(copied_out.error<FetchError>().url, "/b");
+}
+
+}  // namespace result
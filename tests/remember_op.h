@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 #include <sstream>
 #include <utility>
@@ -31,6 +33,9 @@ namespace detail {
 
 static OpCollector* op_collector_{nullptr};  // NOLINT
 
+// Operations of each type so far, counted whether an OpCollector is alive or not
+inline std::array<std::atomic<size_t>, ASSIGN_MOVE_CONST + 1> op_counts_{};  // NOLINT
+
 }  // namespace detail
 
 struct OpCollector {
@@ -45,12 +50,18 @@ struct OpCollector {
     }
 
     static void push(Type type, int index) noexcept {
+        detail::op_counts_[type].fetch_add(1, std::memory_order_relaxed);
         if (detail::op_collector_ == nullptr) {
             return;
         }
         detail::op_collector_->ops.emplace_back(type, index);
     }
 
+    // Operations of the given type made by all RememberLastOp objects so far
+    static size_t count(Type type) noexcept {
+        return detail::op_counts_[type].load(std::memory_order_relaxed);
+    }
+
     template <typename... Args>
     bool equal(const Args&... args) noexcept {
         std::array<Op, sizeof...(args)> compare_to{args...};
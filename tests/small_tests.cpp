@@ -185,6 +185,33 @@ TEST(ConvertConstruct, DifferentValueTypeVal) {
     EXPECT_EQ(r.value(), 2L);
 }
 
+TEST(ConvertConstruct, Widen) {
+    Result<int, short, float> r = makeError(short{3});
+    Result<int, char, float, double, short> u = std::move(r);
+
+    EXPECT_TRUE(u.hasError<short>());
+    EXPECT_EQ(u.error<short>(), 3);
+
+    Result<int, float, short> v = 4;
+    Result<int, char, float, double, short> w = v;
+    EXPECT_EQ(w.value(), 4);
+}
+
+TEST(ConvertAssign, Widen) {
+    Result<int, char, float, double, short> u = 1;
+    u = Result<int, short, float>(makeError(2.f));
+
+    EXPECT_TRUE(u.hasError<float>());
+    EXPECT_EQ(u.error<float>(), 2.f);
+
+    u = makeError(short{5});
+    EXPECT_TRUE(u.hasError<short>());
+    EXPECT_EQ(u.error<short>(), 5);
+
+    u = Result<int, short>(6);
+    EXPECT_EQ(u.value(), 6);
+}
+
 TEST(SwitchIndex, Correct) {
     Result<int, float, int> r = makeError(1.f);
 
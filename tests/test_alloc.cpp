@@ -0,0 +1,111 @@
+#include "result/arena.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <string>
+
+namespace result {
+
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    size_t allocations = 0;
+
+ private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+using Alloc = std::pmr::polymorphic_allocator<>;
+using Message = std::pmr::string;
+
+constexpr const char* LongText = "a message that does not fit into the small string buffer";
+
+TEST(Allocator, MakeError) {
+    CountingResource resource;
+    Result<int, Message> r = makeError<Message>(std::allocator_arg, Alloc(&resource), LongText);
+
+    EXPECT_EQ(r.error<Message>(), LongText);
+    EXPECT_EQ(r.error<Message>().get_allocator().resource(), &resource);
+    EXPECT_EQ(resource.allocations, 1U);
+}
+
+TEST(Allocator, ErrTag) {
+    CountingResource resource;
+    Result<int, Message> r(std::allocator_arg, Alloc(&resource), err_tag<Message>, LongText);
+
+    EXPECT_EQ(r.error<Message>().get_allocator().resource(), &resource);
+}
+
+TEST(Allocator, Value) {
+    CountingResource resource;
+    Result<Message, int> r(std::allocator_arg, Alloc(&resource), std::in_place, LongText);
+
+    EXPECT_EQ(*r, LongText);
+    EXPECT_EQ(r->get_allocator().resource(), &resource);
+}
+
+TEST(Allocator, ConvertWithAllocator) {
+    CountingResource resource;
+    Result<int, Message> r = makeError<Message>(LongText);
+    Result<int, char, Message> u(std::allocator_arg, Alloc(&resource), r);
+
+    EXPECT_EQ(u.error<Message>(), LongText);
+    EXPECT_EQ(u.error<Message>().get_allocator().resource(), &resource);
+    EXPECT_EQ(r.error<Message>().get_allocator().resource(), std::pmr::get_default_resource());
+}
+
+TEST(Allocator, NotAllocatorAware) {
+    CountingResource resource;
+    Result<int, std::string> r =
+        makeError<std::string>(std::allocator_arg, Alloc(&resource), LongText);
+
+    EXPECT_EQ(r.error<std::string>(), LongText);
+    EXPECT_EQ(resource.allocations, 0U);
+}
+
+TEST(ErrorArena, Scope) {
+    auto& arena = ErrorArena::local();
+
+    {
+        ErrorArena::Scope scope;
+        Result<int, Message> r = makeError<Message>(std::allocator_arg, arena.allocator(), LongText);
+        EXPECT_EQ(r.error<Message>().get_allocator().resource(), arena.resource());
+    }
+
+    Result<int, Message> r = makeError<Message>(std::allocator_arg, arena.allocator(), LongText);
+    EXPECT_EQ(r.error<Message>(), LongText);
+}
+
+// The next scope allocates from the start of the buffer again
+TEST(ErrorArena, ScopeReclaims) {
+    auto& arena = ErrorArena::local();
+    auto allocateError = [&] {
+        ErrorArena::Scope scope;
+        Result<int, Message> r =
+            makeError<Message>(std::allocator_arg, arena.allocator(), LongText);
+        return static_cast<const void*>(r.error<Message>().data());
+    };
+
+    // Earlier tests may have left errors allocated outside of a scope
+    {
+        ErrorArena::Scope clean;
+    }
+
+    const void* first = allocateError();
+    EXPECT_EQ(allocateError(), first);
+    EXPECT_EQ(allocateError(), first);
+}
+
+}  // namespace result
@@ -0,0 +1,174 @@
+#include "./budget.h"
+#include "./remember_op.h"
+
+#include "result/combine/and_then.h"
+#include "result/combine/erase_errors.h"
+#include "result/combine/lift.h"
+#include "result/combine/map.h"
+#include "result/combine/map_err.h"
+#include "result/combine/or_else.h"
+#include "result/coro.h"
+#include "result/error/shared.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+#include "result/task.h"
+#include "result/union.h"
+#include "result/validate.h"
+
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace result {
+
+using BudgetVal = test::RememberLastOp<0>;
+using BudgetErr = test::RememberLastOp<1>;
+using BudgetRes = Result<BudgetVal, BudgetErr>;
+
+struct OtherError {};
+
+using WideRes = Result<BudgetVal, OtherError, BudgetErr>;
+using SharedRes = Union<BudgetVal, BudgetRes, Result<BudgetVal, Shared<BudgetErr>>>;
+
+TEST(Budget, Harness) {
+    EXPECT_BUDGET(std::make_unique<int>(1), allocs = 1, moves = 0, copies = 0);
+    EXPECT_BUDGET(BudgetVal(), allocs = 0, moves = 0, copies = 0);
+
+    BudgetVal v;
+    EXPECT_BUDGET(BudgetVal(std::move(v)), moves = 1, copies = 0);
+    EXPECT_BUDGET(BudgetVal(v), moves = 0, copies = 1);
+
+    // The expression sees the caller's variables, not the names of the limits
+    const std::vector<BudgetVal> moves(2);
+    EXPECT_BUDGET(BudgetVal(moves[0]), allocs = 0, moves = 0, copies = 1);
+}
+
+BudgetVal movedOnce() {
+    BudgetVal v;
+    return BudgetVal(std::move(v));
+}
+
+TEST(Budget, ReportsOverruns) {
+    EXPECT_NONFATAL_FAILURE(EXPECT_BUDGET(std::vector<int>(16), allocs = 0), "allocs = 0, used 1");
+    EXPECT_NONFATAL_FAILURE(EXPECT_BUDGET(movedOnce(), moves <= 0), "moves <= 0, used 1");
+}
+
+TEST(Budget, Construction) {
+    EXPECT_BUDGET(BudgetRes(), allocs = 0, moves = 0, copies = 0);
+    EXPECT_BUDGET(BudgetRes(BudgetVal()), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(BudgetRes(makeError<BudgetErr>()), allocs = 0, moves <= 1, copies = 0);
+}
+
+TEST(Budget, Conversion) {
+    BudgetRes value;
+    BudgetRes error = makeError<BudgetErr>();
+
+    EXPECT_BUDGET(BudgetRes(value), allocs = 0, moves = 0, copies = 1);
+    EXPECT_BUDGET(WideRes(value), allocs = 0, moves = 0, copies = 1);
+    EXPECT_BUDGET(WideRes(std::move(value)), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(WideRes(std::move(error)), allocs = 0, moves = 1, copies = 0);
+
+    // Wrapping into Shared<E> is the only allocation
+    static_assert(std::is_same_v<SharedRes, Result<BudgetVal, Shared<BudgetErr>>>);
+    BudgetRes unshared = makeError<BudgetErr>();
+    EXPECT_BUDGET(SharedRes(std::move(value)), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(SharedRes(std::move(unshared)), allocs = 1, moves = 2, copies = 0);
+}
+
+TEST(Budget, Assignment) {
+    BudgetRes value;
+    BudgetRes error = makeError<BudgetErr>();
+    WideRes wide;
+
+    // Same alternative: assigned in place, otherwise destroyed and constructed
+    EXPECT_BUDGET(wide = value, allocs = 0, moves = 0, copies = 1);
+    EXPECT_BUDGET(wide = std::move(value), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(wide = std::move(error), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(wide = std::move(error), allocs = 0, moves = 1, copies = 0);
+    EXPECT_BUDGET(wide = BudgetRes(), allocs = 0, moves = 1, copies = 0);
+}
+
+// Upper bounds: the moves through pipes and handlers are up to the optimizer
+TEST(Budget, Combinators) {
+    BudgetRes value;
+    BudgetRes error = makeError<BudgetErr>();
+
+    auto identity = [](BudgetVal v) { return v; };
+    auto next = [](BudgetVal v) -> Result<BudgetVal, OtherError> { return v; };
+    auto recover = [](BudgetErr) -> Result<BudgetVal, OtherError> { return BudgetVal(); };
+    auto mapError = [](BudgetErr) { return OtherError{}; };
+
+    EXPECT_BUDGET(std::move(value) | map(identity), allocs = 0, moves <= 6, copies = 0);
+    EXPECT_BUDGET(std::move(error) | map(identity), allocs = 0, moves <= 4, copies = 0);
+
+    EXPECT_BUDGET(std::move(value) | andThen(next), allocs = 0, moves <= 6, copies = 0);
+    EXPECT_BUDGET(std::move(error) | andThen(next), allocs = 0, moves <= 4, copies = 0);
+
+    EXPECT_BUDGET(std::move(value) | orElse(recover), allocs = 0, moves <= 4, copies = 0);
+    EXPECT_BUDGET(std::move(error) | orElse(recover), allocs = 0, moves <= 5, copies = 0);
+
+    EXPECT_BUDGET(std::move(value) | mapErr(mapError), allocs = 0, moves <= 4, copies = 0);
+    EXPECT_BUDGET(std::move(error) | mapErr(mapError), allocs = 0, moves <= 4, copies = 0);
+
+    // Small errors are erased inline
+    EXPECT_BUDGET(std::move(value) | eraseErrors(), allocs = 0, moves <= 4, copies = 0);
+    EXPECT_BUDGET(std::move(error) | eraseErrors(), allocs = 0, moves <= 4, copies = 0);
+
+    // The moves of BudgetErr into the lifter included
+    EXPECT_BUDGET(std::optional<BudgetVal>(std::in_place) | lift(BudgetErr()),
+                  allocs = 0,
+                  moves <= 3,
+                  copies = 0);
+    EXPECT_BUDGET(std::optional<BudgetVal>() | lift(BudgetErr()),
+                  allocs = 0,
+                  moves <= 3,
+                  copies = 0);
+}
+
+TEST(Budget, ValidateAll) {
+    BudgetRes a;
+    BudgetRes b;
+    BudgetRes error = makeError<BudgetErr>();
+
+    // Errors are collected inline, then moved out twice
+    EXPECT_BUDGET(validateAll(std::move(a), std::move(b)), allocs = 0, moves <= 2, copies = 0);
+    EXPECT_BUDGET(validateAll(std::move(error), std::move(b)), allocs = 0, moves <= 3, copies = 0);
+}
+
+BudgetRes budgetReturn() {
+    co_return BudgetVal{};
+}
+
+BudgetRes budgetAwait() {
+    co_return co_await budgetReturn();
+}
+
+BudgetRes budgetFail() {
+    co_await BudgetRes(makeError<BudgetErr>());
+    std::unreachable();
+}
+
+// A frame per coroutine at most, unless the compiler elides it
+TEST(Budget, Coroutines) {
+    EXPECT_BUDGET(budgetReturn(), allocs <= 1, moves <= 1, copies = 0);
+    EXPECT_BUDGET(budgetAwait(), allocs <= 2, moves <= 3, copies = 0);
+    EXPECT_BUDGET(budgetFail(), allocs <= 1, moves <= 2, copies = 0);
+}
+
+Task<BudgetRes> budgetTask() {
+    co_return BudgetVal{};
+}
+
+Task<BudgetRes> budgetTaskFail() {
+    co_return makeError<BudgetErr>();
+}
+
+// Frames of the task and of syncWait(), and the Result moved out of each
+TEST(Budget, Tasks) {
+    EXPECT_BUDGET(syncWait(budgetTask()), allocs <= 2, moves <= 4, copies = 0);
+    EXPECT_BUDGET(syncWait(budgetTaskFail()), allocs <= 2, moves <= 4, copies = 0);
+}
+
+}  // namespace result
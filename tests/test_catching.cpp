@@ -0,0 +1,132 @@
+#include "result/catching.h"
+#include "result/coro.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace result {
+
+struct Parse {
+    int parse(const std::string& s) const {
+        if (s.empty()) {
+            throw std::invalid_argument("empty");
+        }
+        if (s == "io") {
+            throw std::system_error(std::make_error_code(std::errc::io_error));
+        }
+        if (s == "int") {
+            throw 42;
+        }
+        return static_cast<int>(s.size());
+    }
+};
+
+TEST(Catching, Value) {
+    auto parse =
+        catching<std::invalid_argument>([](const std::string& s) { return Parse{}.parse(s); });
+
+    Result<int, std::invalid_argument> r = parse("abc");
+    EXPECT_EQ(*r, 3);
+}
+
+TEST(Catching, MapsListedExceptions) {
+    auto parse = catching<std::invalid_argument, std::system_error>(&Parse::parse);
+    const Parse p;
+
+    auto r = parse(p, "");
+    ASSERT_TRUE(r.hasError<std::invalid_argument>());
+    EXPECT_STREQ(r.error<std::invalid_argument>().what(), "empty");
+
+    r = parse(p, "io");
+    ASSERT_TRUE(r.hasError<std::system_error>());
+    EXPECT_EQ(r.error<std::system_error>().code(), std::errc::io_error);
+
+    EXPECT_THROW(parse(p, "int"), int);
+}
+
+TEST(Catching, FirstMatchingTypeWins) {
+    auto parse = catching<std::logic_error, std::invalid_argument>(&Parse::parse);
+
+    auto r = parse(Parse{}, "");
+    EXPECT_TRUE(r.hasError<std::logic_error>());
+}
+
+TEST(Catching, ExceptionErrorCatchesAnything) {
+    auto parse = catching<std::system_error, ExceptionError>(&Parse::parse);
+
+    auto r = parse(Parse{}, "int");
+    ASSERT_TRUE(r.hasError<ExceptionError>());
+    EXPECT_EQ(r.error<ExceptionError>().message(), "unknown exception");
+    EXPECT_THROW(r.error<ExceptionError>().rethrow(), int);
+
+    r = parse(Parse{}, "");
+    EXPECT_EQ(r.error<ExceptionError>().message(), "empty");
+}
+
+struct NotFound {};
+
+TEST(Catching, ResultsAndVoid) {
+    auto find = catching<std::out_of_range>([](int key) -> Result<int, NotFound> {
+        if (key < 0) {
+            throw std::out_of_range("key");
+        }
+        if (key == 0) {
+            return makeError(NotFound{});
+        }
+        return key;
+    });
+
+    static_assert(std::is_same_v<decltype(find(1)), Result<int, NotFound, std::out_of_range>>);
+    EXPECT_EQ(*find(1), 1);
+    EXPECT_TRUE(find(0).hasError<NotFound>());
+    EXPECT_TRUE(find(-1).hasError<std::out_of_range>());
+
+    auto check = catching<std::out_of_range>([](int x) {
+        if (x < 0) {
+            throw std::out_of_range("x");
+        }
+    });
+    static_assert(std::is_same_v<decltype(check(1)), Result<Unit, std::out_of_range>>);
+    EXPECT_TRUE(check(1).hasValue());
+    EXPECT_TRUE(check(-1).hasError<std::out_of_range>());
+}
+
+TEST(ValueOrThrow, RoundTrip) {
+    Result<int, std::invalid_argument, NotFound> r = 5;
+    EXPECT_EQ(r.valueOrThrow(), 5);
+
+    r = makeError(NotFound{});
+    EXPECT_THROW((void)r.valueOrThrow(), NotFound);
+
+    auto parse = catching<std::invalid_argument>(&Parse::parse);
+    r = parse(Parse{}, "");
+    EXPECT_THROW((void)r.valueOrThrow(), std::invalid_argument);
+}
+
+// The exception caught by ExceptionError is rethrown as itself
+TEST(ValueOrThrow, ExceptionErrorRoundTrip) {
+    auto parse = catching<ExceptionError>(&Parse::parse);
+
+    EXPECT_THROW((void)parse(Parse{}, "").valueOrThrow(), std::invalid_argument);
+    EXPECT_THROW((void)parse(Parse{}, "int").valueOrThrow(), int);
+    EXPECT_EQ(parse(Parse{}, "abc").valueOrThrow(), 3);
+}
+
+Result<int, NotFound, ExceptionError> throwingCoroutine(const std::string& s) {
+    int n = co_await Result<int, NotFound>(static_cast<int>(s.size()));
+    co_return n + Parse{}.parse(s);
+}
+
+TEST(Coroutine, ExceptionsBecomeErrors) {
+    EXPECT_EQ(*throwingCoroutine("ab"), 4);
+
+    auto r = throwingCoroutine("");
+    ASSERT_TRUE(r.hasError<ExceptionError>());
+    EXPECT_EQ(r.error<ExceptionError>().message(), "empty");
+}
+
+}  // namespace result
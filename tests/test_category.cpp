@@ -0,0 +1,86 @@
+#include "result/detail/overloaded.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace result {
+
+struct Timeout {};
+struct Unavailable {};
+struct BadRequest {};
+struct Forbidden {};
+
+using Retryable = ErrorCategory<Timeout, Unavailable>;
+using Fatal = ErrorCategory<BadRequest, Forbidden>;
+
+using Reply = Result<std::string, Timeout, BadRequest, Unavailable, Forbidden>;
+
+TEST(Category, HasErrorIn) {
+    Reply value = std::string("ok");
+    EXPECT_FALSE(value.hasErrorIn<Retryable>());
+    EXPECT_FALSE(value.hasErrorIn<Fatal>());
+
+    Reply timeout = makeError(Timeout{});
+    EXPECT_TRUE(timeout.hasErrorIn<Retryable>());
+    EXPECT_FALSE(timeout.hasErrorIn<Fatal>());
+
+    Reply forbidden = makeError(Forbidden{});
+    EXPECT_FALSE(forbidden.hasErrorIn<Retryable>());
+    EXPECT_TRUE(forbidden.hasErrorIn<Fatal>());
+
+    // Types the Result does not have are ignored
+    Result<int, Unavailable> unavailable = makeError(Unavailable{});
+    EXPECT_TRUE(unavailable.hasErrorIn<Retryable>());
+    EXPECT_FALSE(unavailable.hasErrorIn<Fatal>());
+    EXPECT_FALSE(unavailable.hasErrorIn<ErrorCategory<>>());
+}
+
+TEST(Category, VisitCategory) {
+    auto route = [](const Reply& r) {
+        return r.visitCategory<Retryable, Fatal>(detail::Overloaded{
+            [](val_tag_t, const std::string& reply) { return reply; },
+            [](category_tag_t<Retryable>) { return std::string("retry"); },
+            [](category_tag_t<Fatal>) { return std::string("reject"); },
+        });
+    };
+
+    EXPECT_EQ(route(std::string("ok")), "ok");
+    EXPECT_EQ(route(makeError(Timeout{})), "retry");
+    EXPECT_EQ(route(makeError(Unavailable{})), "retry");
+    EXPECT_EQ(route(makeError(BadRequest{})), "reject");
+    EXPECT_EQ(route(makeError(Forbidden{})), "reject");
+}
+
+TEST(Category, FirstCategoryWins) {
+    using Everything = ErrorCategory<Timeout, Unavailable, BadRequest, Forbidden>;
+
+    Reply timeout = makeError(Timeout{});
+    int category = timeout.visitCategory<Retryable, Everything>(detail::Overloaded{
+        [](val_tag_t, const std::string&) { return 0; },
+        [](category_tag_t<Retryable>) { return 1; },
+        [](category_tag_t<Everything>) { return 2; },
+    });
+    EXPECT_EQ(category, 1);
+}
+
+TEST(Category, MovesValue) {
+    Reply value = std::string("payload");
+    std::string moved = std::move(value).visitCategory<Retryable, Fatal>(detail::Overloaded{
+        [](val_tag_t, std::string&& reply) { return std::move(reply); },
+        [](auto) { return std::string(); },
+    });
+    EXPECT_EQ(moved, "payload");
+}
+
+TEST(Category, ErrorOnly) {
+    Result<detail::Impossible, Timeout> error = makeError(Timeout{});
+    bool retry = error.visitCategory<Retryable>(detail::Overloaded{
+        [](val_tag_t, auto&&) { return false; },
+        [](category_tag_t<Retryable>) { return true; },
+    });
+    EXPECT_TRUE(retry);
+}
+
+}  // namespace result
@@ -0,0 +1,187 @@
+#include "result/channel.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace result {
+
+struct StageFailed {
+    int stage = 0;
+};
+
+using Item = Result<int, StageFailed>;
+
+TEST(Channel, Capacity) {
+    EXPECT_EQ(Channel<Item>(0).capacity(), 2);
+    EXPECT_EQ(Channel<Item>(5).capacity(), 8);
+    EXPECT_EQ(Channel<Item>(64).capacity(), 64);
+}
+
+TEST(Channel, TrySendTryRecv) {
+    Channel<Item> channel(2);
+    EXPECT_FALSE(channel.tryRecv().has_value());
+
+    EXPECT_TRUE(channel.trySend(1));
+    EXPECT_TRUE(channel.trySend(makeError(StageFailed{2})));
+
+    // Full: the Result is left to the caller
+    Item third = 3;
+    EXPECT_FALSE(channel.trySend(std::move(third)));
+    EXPECT_EQ(*third, 3);
+
+    EXPECT_EQ(*channel.tryRecv().value(), 1);
+    EXPECT_EQ(channel.tryRecv()->error<StageFailed>().stage, 2);
+    EXPECT_FALSE(channel.tryRecv().has_value());
+}
+
+TEST(Channel, Batches) {
+    Channel<Item> channel(8);
+
+    std::vector<Item> in{1, 2, 3, makeError(StageFailed{4}), 5};
+    EXPECT_EQ(channel.sendBatch(in), 5);
+
+    std::vector<Item> out(3);
+    ASSERT_EQ(channel.recvBatch(out), 3);
+    EXPECT_EQ(*out[2], 3);
+
+    ASSERT_EQ(channel.recvBatch(out), 2);
+    EXPECT_TRUE(out[0].hasError<StageFailed>());
+    EXPECT_EQ(*out[1], 5);
+}
+
+TEST(Channel, Close) {
+    Channel<Item> channel(4);
+    EXPECT_TRUE(channel.send(1));
+    channel.close();
+
+    EXPECT_TRUE(channel.closed());
+    EXPECT_FALSE(channel.send(2));
+
+    // Drained before reporting the end
+    EXPECT_EQ(*channel.recv().value(), 1);
+    EXPECT_FALSE(channel.recv().has_value());
+}
+
+TEST(Channel, CloseOnError) {
+    Channel<Item> channel(8, ChannelMode::CloseOnError);
+
+    std::vector<Item> in{1, makeError(StageFailed{2}), 3};
+    EXPECT_EQ(channel.sendBatch(in), 2);
+    EXPECT_TRUE(channel.closed());
+    EXPECT_EQ(*in[2], 3);
+
+    EXPECT_EQ(*channel.recv().value(), 1);
+    EXPECT_TRUE(channel.recv()->hasError<StageFailed>());
+    EXPECT_FALSE(channel.recv().has_value());
+}
+
+// Whatever the interleaving, nothing is received after the first error
+TEST(Channel, CloseOnErrorProducers) {
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 20'000;
+
+    Channel<Item> channel(64, ChannelMode::CloseOnError);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < Producers; ++p) {
+        producers.emplace_back([&, p] {
+            const int fail_at = PerProducer / 2 + p;
+            std::vector<Item> batch;
+            for (int i = 1; i <= PerProducer; ++i) {
+                batch.push_back(i == fail_at ? Item(makeError(StageFailed{p})) : Item(i));
+                if (batch.size() == 8 || i == PerProducer) {
+                    if (channel.sendBatch(batch) < batch.size()) {
+                        return;
+                    }
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    std::vector<Item> received;
+    while (auto r = channel.recv()) {
+        received.push_back(std::move(*r));
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    ASSERT_FALSE(received.empty());
+    EXPECT_TRUE(received.back().hasError<StageFailed>());
+    EXPECT_EQ(std::ranges::count_if(received, [](const Item& r) { return r.hasAnyError(); }), 1);
+}
+
+TEST(Channel, DestroysWhatIsLeft) {
+    auto payload = std::make_shared<int>(0);
+    {
+        Channel<Result<std::shared_ptr<int>, StageFailed>> channel(4);
+        EXPECT_TRUE(channel.send(payload));
+        EXPECT_TRUE(channel.send(payload));
+        EXPECT_EQ(payload.use_count(), 3);
+    }
+    EXPECT_EQ(payload.use_count(), 1);
+}
+
+TEST(Channel, ProducersAndConsumers) {
+    constexpr int Producers = 4;
+    constexpr int Consumers = 4;
+    constexpr int PerProducer = 50'000;
+
+    Channel<Item> channel(64);
+    std::vector<long long> sums(Consumers, 0);
+    std::vector<int> errors(Consumers, 0);
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < Consumers; ++c) {
+        consumers.emplace_back([&, c] {
+            std::vector<Item> batch(16);
+            while (size_t n = channel.recvBatch(batch)) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (batch[i].hasValue()) {
+                        sums[c] += *batch[i];
+                    } else {
+                        ++errors[c];
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < Producers; ++p) {
+        producers.emplace_back([&] {
+            std::vector<Item> batch;
+            for (int i = 1; i <= PerProducer; ++i) {
+                batch.push_back(i % 100 == 0 ? Item(makeError(StageFailed{i})) : Item(i));
+                if (batch.size() == 8 || i == PerProducer) {
+                    EXPECT_EQ(channel.sendBatch(batch), batch.size());
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+    channel.close();
+    for (auto& t : consumers) {
+        t.join();
+    }
+
+    long long expected = 0;
+    for (int i = 1; i <= PerProducer; ++i) {
+        expected += i % 100 == 0 ? 0 : i;
+    }
+    EXPECT_EQ(std::accumulate(sums.begin(), sums.end(), 0LL), Producers * expected);
+    EXPECT_EQ(std::accumulate(errors.begin(), errors.end(), 0), Producers * PerProducer / 100);
+}
+
+}  // namespace result
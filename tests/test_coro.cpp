@@ -1,7 +1,11 @@
 #include "result/coro.h"
 
+#include "./remember_op.h"
+
 #include <gtest/gtest.h>
 
+#include <coroutine>
+
 namespace result {
 
 template <typename T>
@@ -43,4 +47,158 @@ TEST(Coro, Faulty) {
     EXPECT_EQ(x.error<std::string>(), "hello");
 }
 
+TEST(Coro, AwaitLvalue) {
+    Res<int> r = 2;
+    Res<int> e = makeError<std::string>("hello");
+
+    Res<int> x = [&] -> Res<int> {
+        int& v = co_await r;
+        co_return v + 1;
+    }();
+
+    Res<int> y = [&] -> Res<int> {
+        int& v = co_await e;
+        co_return v + 1;
+    }();
+
+    EXPECT_EQ(x.value(), 3);
+    EXPECT_EQ(y.error<std::string>(), "hello");
+    EXPECT_EQ(e.error<std::string>(), "hello");
+}
+
+// Tells the coroutine where its promise constructs the returned Result
+struct ReturnSlotAddress {
+    const void** out;
+
+    bool await_ready() noexcept {  // NOLINT
+        return false;
+    }
+
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> h) noexcept {  // NOLINT
+        *out = h.promise().slot.address();
+        return false;
+    }
+
+    void await_resume() noexcept {}  // NOLINT
+};
+
+TEST(Coro, ReturnSlot) {
+    const void* slot = nullptr;
+    Res<int> r = [&] -> Res<int> {
+        co_await ReturnSlotAddress{&slot};
+        co_return 1;
+    }();
+
+    EXPECT_EQ(*r, 1);
+#if RESULT_CORO_DIRECT_RETURN
+    EXPECT_EQ(slot, &r);
+#else
+    EXPECT_NE(slot, &r);
+#endif
+}
+
+using OpVal = test::RememberLastOp<0>;
+using OpErr = test::RememberLastOp<1>;
+using OpRes = Result<OpVal, OpErr>;
+
+OpRes returnValue() {
+    co_return OpVal{};
+}
+
+OpRes returnError() {
+    co_return makeError<OpErr>();
+}
+
+OpRes awaitValue() {
+    co_return co_await returnValue();
+}
+
+OpRes awaitError() {
+    co_await returnError();
+    std::unreachable();
+}
+
+OpRes awaitLvalue(OpRes& r) {
+    [[maybe_unused]] OpVal& v = co_await r;
+    co_return makeError<OpErr>();
+}
+
+TEST(CoroOps, ReturnValue) {
+    if (!RESULT_CORO_DIRECT_RETURN) {
+        GTEST_SKIP() << "the Result is staged and moved out once";
+    }
+    test::OpCollector collector;
+    OpRes r = returnValue();
+
+    EXPECT_TRUE(r.hasValue());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 0),
+        test::Op(test::CONSTRUCT_MOVE, 0),
+        test::Op(test::Destroy, 0)));
+}
+
+TEST(CoroOps, ReturnError) {
+    if (!RESULT_CORO_DIRECT_RETURN) {
+        GTEST_SKIP() << "the Result is staged and moved out once";
+    }
+    test::OpCollector collector;
+    OpRes r = returnError();
+
+    EXPECT_TRUE(r.hasError<OpErr>());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1)));
+}
+
+TEST(CoroOps, AwaitValue) {
+    if (!RESULT_CORO_DIRECT_RETURN) {
+        GTEST_SKIP() << "the Result is staged and moved out once";
+    }
+    test::OpCollector collector;
+    OpRes r = awaitValue();
+
+    EXPECT_TRUE(r.hasValue());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 0),
+        test::Op(test::CONSTRUCT_MOVE, 0),
+        test::Op(test::Destroy, 0),
+        test::Op(test::CONSTRUCT_MOVE, 0),
+        test::Op(test::CONSTRUCT_MOVE, 0),
+        test::Op(test::Destroy, 0),
+        test::Op(test::Destroy, 0)));
+}
+
+TEST(CoroOps, AwaitError) {
+    if (!RESULT_CORO_DIRECT_RETURN) {
+        GTEST_SKIP() << "the Result is staged and moved out once";
+    }
+    test::OpCollector collector;
+    OpRes r = awaitError();
+
+    EXPECT_TRUE(r.hasError<OpErr>());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1)));
+}
+
+TEST(CoroOps, AwaitLvalue) {
+    if (!RESULT_CORO_DIRECT_RETURN) {
+        GTEST_SKIP() << "the Result is staged and moved out once";
+    }
+    OpRes from;
+    test::OpCollector collector;
+    OpRes r = awaitLvalue(from);
+
+    EXPECT_TRUE(from.hasValue());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1)));
+}
+
 }  // namespace result
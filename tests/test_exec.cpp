@@ -0,0 +1,193 @@
+#include "result/combine/and_then.h"
+#include "result/combine/map.h"
+#include "result/exec.h"
+
+#include <gtest/gtest.h>
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace result {
+
+struct ExecIoError {
+    int code = 0;
+};
+
+struct ExecParseError {};
+
+using Read = Result<int, ExecIoError, ExecParseError>;
+
+// Throws when moved while `fail` is set
+struct Fragile {
+    static inline bool fail = false;
+
+    Fragile() = default;
+
+    Fragile(Fragile&&) noexcept(false) {
+        if (fail) {
+            throw std::runtime_error("fragile");
+        }
+    }
+};
+
+namespace {
+
+std::string describe(int x) {
+    return std::to_string(x);
+}
+
+std::string describe(const ExecIoError& e) {
+    return "io " + std::to_string(e.code);
+}
+
+std::string describe(const ExecParseError&) {
+    return "parse";
+}
+
+std::string describe(const detail::Impossible&) {
+    return "impossible";
+}
+
+std::string describe(const Fragile&) {
+    return "fragile";
+}
+
+std::string describe(const std::exception_ptr&) {
+    return "exception";
+}
+
+template <typename V, typename... Es>
+std::string describe(const Result<V, Es...>& r) {
+    return r.taggedVisit(detail::Overloaded{
+        [](val_tag_t, const auto& value) { return "ok " + describe(value); },
+        [](const auto& error) { return "err " + describe(error); },
+    });
+}
+
+// Records how the sender completed
+struct Recorder {
+    using receiver_concept = exec::receiver_t;
+
+    std::string* log;
+
+    void set_value() && noexcept {  // NOLINT
+        *log = "value";
+    }
+
+    template <typename A>
+    void set_value(A&& a) && noexcept {  // NOLINT
+        *log = "value " + describe(a);
+    }
+
+    template <typename E>
+    void set_error(E&& e) && noexcept {  // NOLINT
+        *log = "error " + describe(e);
+    }
+
+    void set_stopped() && noexcept {  // NOLINT
+        *log = "stopped";
+    }
+};
+
+template <exec::Sender S>
+std::string run(S&& sender) {
+    std::string log;
+    auto op = std::forward<S>(sender).connect(Recorder{&log});
+    op.start();
+    return log;
+}
+
+}  // namespace
+
+TEST(Exec, SplitErrors) {
+    using Split = decltype(exec::just(Read(1)) | exec::splitErrors());
+    static_assert(std::is_same_v<
+                  exec::CompletionSignaturesOf<Split>,
+                  exec::completion_signatures<
+                      exec::set_value_t(int),
+                      exec::set_error_t(ExecIoError),
+                      exec::set_error_t(ExecParseError)>>);
+
+    EXPECT_EQ(run(exec::just(Read(1)) | exec::splitErrors()), "value 1");
+    EXPECT_EQ(run(exec::splitErrors(exec::just(Read(makeError(ExecIoError{5}))))), "error io 5");
+    EXPECT_EQ(run(exec::just(Read(makeError(ExecParseError{}))) | exec::splitErrors()),
+              "error parse");
+}
+
+TEST(Exec, SplitStatus) {
+    using Done = Result<Unit, ExecIoError>;
+    EXPECT_EQ(run(exec::just(Done()) | exec::splitErrors()), "value");
+}
+
+TEST(Exec, ForwardsOtherCompletions) {
+    EXPECT_EQ(run(exec::justStopped() | exec::splitErrors()), "stopped");
+    EXPECT_EQ(run(exec::justError(ExecIoError{7}) | exec::splitErrors()), "error io 7");
+}
+
+TEST(Exec, ToResult) {
+    using Collected = decltype(exec::justError(ExecIoError{}) | exec::toResult());
+    static_assert(std::is_same_v<
+                  exec::CompletionSignaturesOf<Collected>,
+                  exec::completion_signatures<
+                      exec::set_value_t(Result<detail::Impossible, ExecIoError>)>>);
+
+    EXPECT_EQ(run(exec::just(3) | exec::toResult()), "value ok 3");
+    EXPECT_EQ(run(exec::justError(ExecIoError{2}) | exec::toResult()), "value err io 2");
+}
+
+TEST(Exec, ToResultThrows) {
+    using Collected = decltype(exec::just(Fragile()) | exec::toResult());
+    static_assert(std::is_same_v<
+                  exec::CompletionSignaturesOf<Collected>,
+                  exec::completion_signatures<
+                      exec::set_value_t(Result<Fragile>),
+                      exec::set_error_t(std::exception_ptr)>>);
+
+    EXPECT_EQ(run(exec::just(Fragile()) | exec::toResult()), "value ok fragile");
+
+    std::string log;
+    auto op = (exec::just(Fragile()) | exec::toResult()).connect(Recorder{&log});
+    Fragile::fail = true;
+    op.start();
+    Fragile::fail = false;
+    EXPECT_EQ(log, "error exception");
+}
+
+TEST(Exec, RoundTrip) {
+    using Back = decltype(exec::just(Read(1)) | exec::splitErrors() | exec::toResult());
+    static_assert(std::is_same_v<
+                  exec::CompletionSignaturesOf<Back>,
+                  exec::completion_signatures<exec::set_value_t(Read)>>);
+
+    EXPECT_EQ(run(exec::just(Read(4)) | exec::splitErrors() | exec::toResult()), "value ok 4");
+    EXPECT_EQ(
+        run(exec::just(Read(makeError(ExecParseError{}))) | exec::splitErrors() |
+            exec::toResult()),
+        "value err parse");
+}
+
+TEST(Exec, Then) {
+    auto twice = [](int x) { return 2 * x; };
+    auto checked = [](int x) -> Result<int, ExecParseError> {
+        if (x > 10) {
+            return makeError(ExecParseError{});
+        }
+        return x;
+    };
+
+    EXPECT_EQ(run(exec::just(Read(2)) | exec::then(map(twice))), "value ok 4");
+    EXPECT_EQ(run(exec::then(exec::just(Read(2)), andThen(checked))), "value ok 2");
+    EXPECT_EQ(run(exec::just(Read(20)) | exec::then(andThen(checked))), "value err parse");
+    EXPECT_EQ(
+        run(exec::just(Read(makeError(ExecIoError{1}))) | exec::then(map(twice))),
+        "value err io 1");
+
+    // Then composes with the split channels
+    EXPECT_EQ(
+        run(exec::just(Read(3)) | exec::then(map(twice)) | exec::splitErrors()), "value 6");
+}
+
+}  // namespace result
@@ -0,0 +1,143 @@
+#include "result/future.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace result {
+
+namespace {
+
+using Res = Result<int, std::string>;
+using Out = Result<int, std::string, BrokenPromise>;
+
+static_assert(std::is_same_v<Future<Res>::Output, Out>);
+
+class PoolResource : public std::pmr::memory_resource {
+ public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+ private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+}  // namespace
+
+TEST(Future, SetThenGet) {
+    Promise<Res> promise;
+    auto future = promise.getFuture();
+    EXPECT_FALSE(future.isReady());
+
+    promise.setResult(1);
+    EXPECT_TRUE(future.isReady());
+    EXPECT_EQ(*std::move(future).get(), 1);
+    EXPECT_FALSE(future.valid());
+}
+
+TEST(Future, Error) {
+    Promise<Res> promise;
+    auto future = promise.getFuture();
+
+    promise.setResult(Res(makeError(std::string("fail"))));
+    auto r = std::move(future).get();
+    ASSERT_TRUE(r.hasError<std::string>());
+    EXPECT_EQ(r.error<std::string>(), "fail");
+}
+
+TEST(Future, BrokenPromise) {
+    Future<Res> future;
+    {
+        Promise<Res> promise;
+        future = promise.getFuture();
+    }
+    EXPECT_TRUE(std::move(future).get().hasError<BrokenPromise>());
+}
+
+TEST(Future, OtherThread) {
+    for (int i = 0; i < 100; ++i) {
+        Promise<Res> promise;
+        auto future = promise.getFuture();
+
+        std::jthread producer([&promise, i] {
+            if (i % 2 == 0) {
+                std::this_thread::yield();
+            }
+            promise.setResult(i);
+        });
+
+        EXPECT_EQ(*std::move(future).get(), i);
+    }
+}
+
+TEST(Future, ContinuationBeforeResult) {
+    Promise<Res> promise;
+    int seen = 0;
+
+    promise.getFuture().then([&seen](Out r) { seen = *r; });
+    EXPECT_EQ(seen, 0);
+
+    promise.setResult(2);
+    EXPECT_EQ(seen, 2);
+}
+
+TEST(Future, ContinuationAfterResult) {
+    Promise<Res> promise;
+    auto future = promise.getFuture();
+    promise.setResult(3);
+
+    int seen = 0;
+    std::move(future).then([&seen](Out r) { seen = *r; });
+    EXPECT_EQ(seen, 3);
+}
+
+TEST(Future, ContinuationOtherThread) {
+    std::atomic<int> seen = 0;
+    {
+        Promise<Res> promise;
+        promise.getFuture().then([&seen](Out r) { seen.store(*r); });
+        std::jthread producer([promise = std::move(promise)] mutable { promise.setResult(4); });
+    }
+    EXPECT_EQ(seen.load(), 4);
+}
+
+TEST(Future, Allocator) {
+    PoolResource resource;
+    {
+        Promise<Res> promise(std::allocator_arg, std::pmr::polymorphic_allocator<>(&resource));
+        auto future = promise.getFuture();
+        promise.setResult(5);
+        EXPECT_EQ(*std::move(future).get(), 5);
+    }
+    EXPECT_EQ(resource.allocations, 1U);
+    EXPECT_EQ(resource.deallocations, 1U);
+}
+
+TEST(Future, NoValueCopies) {
+    using Ptr = Result<std::unique_ptr<int>, std::string>;
+
+    Promise<Ptr> promise;
+    auto future = promise.getFuture();
+    promise.setResult(std::make_unique<int>(6));
+    EXPECT_EQ(**std::move(future).get(), 6);
+}
+
+}  // namespace result
@@ -0,0 +1,161 @@
+#include "result/combine/and_then.h"
+#include "result/memoize.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace result {
+
+namespace {
+
+struct NotFound {};
+struct Transient {};
+
+using Lookup = Result<std::string, NotFound, Transient>;
+
+// Even keys exist, keys divisible by 3 fail transiently, the rest are not found
+struct Backend {
+    std::atomic<int>* calls;
+
+    Lookup operator()(int key) const {
+        calls->fetch_add(1);
+        if (key % 3 == 0) {
+            return makeError(Transient{});
+        }
+        if (key % 2 == 0) {
+            return std::to_string(key);
+        }
+        return makeError(NotFound{});
+    }
+};
+
+}  // namespace
+
+TEST(Memoize, CachesValues) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls});
+
+    EXPECT_EQ(*lookup(2), "2");
+    EXPECT_EQ(*lookup(2), "2");
+    EXPECT_EQ(calls.load(), 1);
+
+    auto stats = lookup.stats();
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+}
+
+TEST(Memoize, NegativeCaching) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls}, MemoizePolicy<NotFound>{});
+
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_EQ(calls.load(), 1);
+
+    EXPECT_TRUE(lookup(3).hasError<Transient>());
+    EXPECT_TRUE(lookup(3).hasError<Transient>());
+    EXPECT_EQ(calls.load(), 3);
+    EXPECT_EQ(lookup.stats().bypasses, 2U);
+}
+
+TEST(Memoize, ErrorsBypassByDefault) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls});
+
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_EQ(calls.load(), 2);
+}
+
+TEST(Memoize, Ttl) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls},
+                          MemoizePolicy<NotFound>{
+                              .error_ttl = std::chrono::nanoseconds(0),
+                          });
+
+    EXPECT_TRUE(lookup(2).hasValue());
+    EXPECT_TRUE(lookup(2).hasValue());
+    EXPECT_EQ(calls.load(), 1);
+
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_TRUE(lookup(1).hasError<NotFound>());
+    EXPECT_EQ(calls.load(), 3);
+}
+
+TEST(Memoize, Bounded) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls}, MemoizePolicy<>{.capacity = 20});
+    EXPECT_EQ(lookup.capacity(), 32U);
+
+    for (int key = 2; key < 2000; key += 6) {
+        lookup(key);
+    }
+    for (int key = 2; key < 2000; key += 6) {
+        lookup(key);
+    }
+
+    auto stats = lookup.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 2 * 333U);
+    EXPECT_LE(stats.hits, lookup.capacity());
+}
+
+TEST(Memoize, MultipleArguments) {
+    int calls = 0;
+    auto concat = memoize([&calls](const std::string& a, int b) -> Result<std::string, NotFound> {
+        ++calls;
+        return a + std::to_string(b);
+    });
+
+    EXPECT_EQ(*concat("a", 1), "a1");
+    EXPECT_EQ(*concat("a", 2), "a2");
+    EXPECT_EQ(*concat("a", 1), "a1");
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(Memoize, Pipe) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls});
+
+    auto r = Result<int, Transient>(4) | andThen(lookup);
+    static_assert(std::is_same_v<decltype(r), Result<std::string, NotFound, Transient>>);
+    EXPECT_EQ(*r, "4");
+
+    r = Result<int, Transient>(4) | andThen(lookup);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(Memoize, Concurrent) {
+    std::atomic<int> calls = 0;
+    auto lookup = memoize(Backend{&calls}, MemoizePolicy<NotFound>{});
+
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([lookup] {
+            for (int i = 0; i < 1000; ++i) {
+                int key = i % 64;
+                auto r = lookup(key);
+                if (key % 3 == 0) {
+                    EXPECT_TRUE(r.hasError<Transient>());
+                } else if (key % 2 == 0) {
+                    EXPECT_EQ(*r, std::to_string(key));
+                } else {
+                    EXPECT_TRUE(r.hasError<NotFound>());
+                }
+            }
+        });
+    }
+    threads.clear();
+
+    auto stats = lookup.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 4000U);
+}
+
+}  // namespace result
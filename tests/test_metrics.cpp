@@ -0,0 +1,153 @@
+#include "result/combine/and_then.h"
+#include "result/combine/map.h"
+#include "result/combine/map_err.h"
+#include "result/combine/or_else.h"
+#include "result/metrics.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace result {
+
+using Buckets = detail::LogLinearBuckets;
+
+TEST(Histogram, Buckets) {
+    for (uint64_t v : {0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 31ULL, 32ULL, 1000ULL, 123456789ULL}) {
+        const size_t i = Buckets::index(v);
+        EXPECT_LE(Buckets::lowerBound(i), v) << v;
+        EXPECT_GE(Buckets::upperBound(i), v) << v;
+    }
+
+    for (size_t i = 0; i + 1 < Buckets::Count; ++i) {
+        EXPECT_EQ(Buckets::upperBound(i) + 1, Buckets::lowerBound(i + 1));
+        EXPECT_EQ(Buckets::index(Buckets::lowerBound(i)), i);
+    }
+
+    EXPECT_EQ(Buckets::index(UINT64_MAX), Buckets::Count - 1);
+}
+
+TEST(Histogram, Snapshot) {
+    LatencyHistogram histogram;
+    for (uint64_t v = 1; v <= 100; ++v) {
+        histogram.record(v);
+    }
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count(), 100U);
+    EXPECT_EQ(snapshot.sum(), 5050U);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), 50.5);
+
+    // Within the relative width of a bucket
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.5)), 50.0, 50.0 / Buckets::SubCount);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.99)), 99.0, 99.0 / Buckets::SubCount);
+    EXPECT_EQ(snapshot.percentile(0.0), 1U);
+}
+
+TEST(Histogram, Merge) {
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.record(10);
+    b.record(1000);
+    b.record(1000);
+
+    auto merged = a.snapshot().merge(b.snapshot());
+    EXPECT_EQ(merged.count(), 3U);
+    EXPECT_EQ(merged.sum(), 2010U);
+    EXPECT_EQ(merged.percentile(0.0), 10U);
+    EXPECT_GE(merged.percentile(1.0), 1000U);
+}
+
+TEST(Histogram, Threads) {
+    LatencyHistogram histogram;
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&histogram] {
+                for (uint64_t i = 0; i < 10000; ++i) {
+                    histogram.record(i);
+                }
+            });
+        }
+    }
+    EXPECT_EQ(histogram.snapshot().count(), 80000U);
+}
+
+TEST(Instrumented, SplitsByOutcome) {
+    StageStats stage("parse");
+    auto parse = [](std::string s) -> Result<int, std::string> {
+        if (s.empty()) {
+            return makeError(std::string("empty"));
+        }
+        return static_cast<int>(s.size());
+    };
+
+    for (const char* input : {"a", "bb", ""}) {
+        auto r = Result<std::string, std::string>(input) | instrumented(stage, andThen(parse));
+        EXPECT_EQ(r.hasValue(), *input != '\0');
+    }
+
+    // Errors of earlier stages pass through untimed
+    auto failed = Result<std::string, std::string>(makeError(std::string("earlier")));
+    EXPECT_FALSE(std::move(failed) | instrumented(stage, andThen(parse)));
+
+    auto snapshot = stage.snapshot();
+    EXPECT_EQ(snapshot.name, "parse");
+    EXPECT_EQ(snapshot.values.count(), 2U);
+    EXPECT_EQ(snapshot.errors.count(), 1U);
+}
+
+TEST(Instrumented, ErrorStages) {
+    StageStats wrap("wrap");
+    StageStats recover("recover");
+    auto wrapped = [](std::string e) { return "wrapped " + e; };
+    auto retry = [](const std::string& e) -> Result<int, std::string> {
+        if (e == "wrapped busy") {
+            return 0;
+        }
+        return makeError(e);
+    };
+
+    for (const char* error : {"busy", "gone"}) {
+        auto r = Result<int, std::string>(makeError(std::string(error))) |
+                 instrumented(wrap, mapErr(wrapped)) | instrumented(recover, orElse(retry));
+        EXPECT_EQ(r.hasValue(), std::string(error) == "busy");
+    }
+
+    // Values pass through both untimed
+    EXPECT_EQ(*(Result<int, std::string>(1) | instrumented(wrap, mapErr(wrapped)) |
+                instrumented(recover, orElse(retry))),
+              1);
+
+    EXPECT_EQ(wrap.snapshot().values.count(), 0U);
+    EXPECT_EQ(wrap.snapshot().errors.count(), 2U);
+    EXPECT_EQ(recover.snapshot().values.count(), 1U);
+    EXPECT_EQ(recover.snapshot().errors.count(), 1U);
+}
+
+TEST(Instrumented, GlobalRegistry) {
+    for (int i = 0; i < 3; ++i) {
+        auto r = Result<int, std::string>(i) |
+                 instrumented("test.metrics.double", map([](int x) { return 2 * x; })) |
+                 instrumented("test.metrics.render", map([](int x) { return std::to_string(x); }));
+        EXPECT_EQ(*r, std::to_string(2 * i));
+    }
+
+    size_t found = 0;
+    for (const auto& stage : StageRegistry::global().snapshot()) {
+        if (stage.name == "test.metrics.double" || stage.name == "test.metrics.render") {
+            EXPECT_EQ(stage.values.count(), 3U);
+            EXPECT_EQ(stage.errors.count(), 0U);
+            ++found;
+        }
+    }
+    EXPECT_EQ(found, 2U);
+    EXPECT_EQ(&StageRegistry::global().stage("test.metrics.double"),
+              &detail::globalStage(std::string("test.metrics.double")));
+}
+
+}  // namespace result
@@ -0,0 +1,176 @@
+#include "result/task.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
+namespace result {
+
+using namespace std::chrono_literals;
+
+struct ReplicaDown {
+    int replica = 0;
+};
+
+struct ReplicaTimeout {};
+
+namespace {
+
+// Simulated replica: answers after `latency`, unless cancelled first
+bool sleepUnlessStopped(std::chrono::milliseconds latency, std::stop_token token) {
+    const auto deadline = std::chrono::steady_clock::now() + latency;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (token.stop_requested()) {
+            return false;
+        }
+        std::this_thread::sleep_for(100us);
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(FirstOk, FastestValueWins) {
+    ThreadPool pool(4);
+
+    Result<int, ReplicaDown, ReplicaTimeout> r = firstOk(
+        pool,
+        [](std::stop_token t) -> Result<int, ReplicaTimeout> {
+            sleepUnlessStopped(200ms, t);
+            return 1;
+        },
+        [](std::stop_token t) -> Result<int, ReplicaDown> {
+            sleepUnlessStopped(1ms, t);
+            return 2;
+        });
+
+    ASSERT_TRUE(r.hasValue());
+    EXPECT_EQ(*r, 2);
+}
+
+TEST(FirstOk, ErrorOfTheEarliestWhenAllFail) {
+    ThreadPool pool(4);
+
+    Result<int, ReplicaDown, ReplicaTimeout> r = firstOk(
+        pool,
+        []() -> Result<int, ReplicaDown> {
+            std::this_thread::sleep_for(5ms);
+            return makeError(ReplicaDown{0});
+        },
+        []() -> Result<int, ReplicaTimeout, ReplicaDown> { return makeError(ReplicaDown{1}); });
+
+    ASSERT_TRUE(r.hasError<ReplicaDown>());
+    EXPECT_EQ(r.error<ReplicaDown>().replica, 0);
+}
+
+TEST(FirstOk, CancelsLosers) {
+    std::atomic<int> started{0};
+    std::atomic<int> cancelled{0};
+    {
+        ThreadPool pool(4);
+
+        auto slow = [&](std::stop_token t) -> Result<int, ReplicaTimeout> {
+            started.fetch_add(1);
+            if (!sleepUnlessStopped(10s, t)) {
+                cancelled.fetch_add(1);
+                return makeError(ReplicaTimeout{});
+            }
+            return 1;
+        };
+
+        // Wins once both losers are running, so that none of them is skipped
+        auto fast = [&] -> Result<int, ReplicaDown> {
+            while (started.load() < 2) {
+                std::this_thread::yield();
+            }
+            return 3;
+        };
+
+        auto r = firstOk(pool, slow, slow, fast);
+        EXPECT_EQ(*r, 3);
+    }
+
+    // The pool drained the losers before its destructor returned
+    EXPECT_EQ(cancelled.load(), 2);
+}
+
+TEST(FirstOk, InlineExecutor) {
+    int calls = 0;
+    InlineExecutor executor;
+
+    auto r = firstOk(
+        executor,
+        [&] -> Result<int, ReplicaDown> {
+            ++calls;
+            return makeError(ReplicaDown{0});
+        },
+        [&] -> Result<int, ReplicaDown> {
+            ++calls;
+            return 1;
+        },
+        [&] -> Result<int, ReplicaDown> {
+            ++calls;
+            return 2;
+        });
+
+    EXPECT_EQ(*r, 1);
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(Hedge, FastPrimarySkipsBackup) {
+    std::atomic<int> backups{0};
+    ThreadPool pool(2);
+
+    auto r = hedge(
+        pool,
+        [] -> Result<int, ReplicaDown> { return 1; },
+        [&] -> Result<int, ReplicaDown> {
+            backups.fetch_add(1);
+            return 2;
+        },
+        1s);
+
+    EXPECT_EQ(*r, 1);
+    EXPECT_EQ(backups.load(), 0);
+}
+
+TEST(Hedge, SlowPrimary) {
+    ThreadPool pool(2);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto r = hedge(
+        pool,
+        [](std::stop_token t) -> Result<int, ReplicaTimeout> {
+            sleepUnlessStopped(10s, t);
+            return 1;
+        },
+        [] -> Result<int, ReplicaDown> { return 2; },
+        5ms);
+
+    EXPECT_EQ(*r, 2);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+}
+
+TEST(Hedge, FailedPrimaryStartsBackupRightAway) {
+    ThreadPool pool(2);
+
+    // The primary fails once hedge() is waiting, so only a notification can end the wait
+    // before the delay. Failing earlier passes as well, without testing the wakeup.
+    const auto start = std::chrono::steady_clock::now();
+    auto r = hedge(
+        pool,
+        [] -> Result<int, ReplicaDown> {
+            std::this_thread::sleep_for(100ms);
+            return makeError(ReplicaDown{0});
+        },
+        [] -> Result<int, ReplicaDown> { return 2; },
+        30s);
+
+    EXPECT_EQ(*r, 2);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 10s);
+}
+
+}  // namespace result
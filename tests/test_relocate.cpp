@@ -0,0 +1,127 @@
+#include "result/relocate.h"
+#include "result/result.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace result {
+
+namespace {
+
+struct Code {
+    int value = 0;
+};
+
+// Points into itself, so its bytes cannot be moved around
+struct SelfRef {
+    SelfRef() noexcept : self(this) {}
+    SelfRef(const SelfRef&) noexcept : self(this) {}
+    SelfRef(SelfRef&&) noexcept : self(this) {}
+    SelfRef& operator=(const SelfRef&) noexcept = default;
+    ~SelfRef() = default;
+
+    SelfRef* self;
+};
+
+struct Handle {
+    explicit Handle(int v) : value(new int(v)) {}
+    Handle(Handle&& other) noexcept : value(std::exchange(other.value, nullptr)) {}
+    ~Handle() {
+        delete value;
+    }
+
+    int* value;
+};
+
+template <typename T>
+struct Storage {
+    T* get() {
+        return reinterpret_cast<T*>(bytes);  // NOLINT
+    }
+
+    alignas(T) std::byte bytes[sizeof(T)];
+};
+
+}  // namespace
+
+template <>
+struct TriviallyRelocatable<Handle> : std::true_type {};
+
+static_assert(isTriviallyRelocatable<Result<int, Code>>);
+static_assert(isTriviallyRelocatable<Result<Handle, Code>>);
+static_assert(!isTriviallyRelocatable<SelfRef>);
+static_assert(!isTriviallyRelocatable<Result<int, Code, SelfRef>>);
+static_assert(!isTriviallyRelocatable<Result<SelfRef, Code>>);
+
+#if RESULT_LIBCPP_RELOCATION
+static_assert(isTriviallyRelocatable<Result<std::unique_ptr<int>, Code>>);
+static_assert(std::__libcpp_is_trivially_relocatable<Result<Handle, Code>>::value);
+#endif
+
+TEST(Relocate, Value) {
+    using R = Result<Handle, Code>;
+
+    Storage<R> from;
+    Storage<R> to;
+    std::construct_at(from.get(), std::in_place, 7);
+
+    R* r = relocateAt(from.get(), to.get());
+    EXPECT_EQ(*r->value().value, 7);
+    std::destroy_at(r);
+}
+
+TEST(Relocate, NotTrivial) {
+    using R = Result<SelfRef, Code>;
+
+    Storage<R> from;
+    Storage<R> to;
+    std::construct_at(from.get());
+
+    R* r = relocateAt(from.get(), to.get());
+    EXPECT_EQ(r->value().self, &r->value());
+    std::destroy_at(r);
+}
+
+TEST(Relocate, Range) {
+    using R = Result<Handle, Code>;
+    constexpr size_t N = 16;
+
+    std::allocator<R> alloc;
+    R* from = alloc.allocate(N);
+    R* to = alloc.allocate(N);
+    for (size_t i = 0; i < N; ++i) {
+        if (i % 2 == 0) {
+            std::construct_at(from + i, std::in_place, static_cast<int>(i));
+        } else {
+            std::construct_at(from + i, makeError(Code{static_cast<int>(i)}));
+        }
+    }
+
+    EXPECT_EQ(uninitializedRelocate(from, from + N, to), to + N);
+    for (size_t i = 0; i < N; ++i) {
+        if (i % 2 == 0) {
+            EXPECT_EQ(*to[i].value().value, static_cast<int>(i));
+        } else {
+            EXPECT_EQ(to[i].error<Code>().value, static_cast<int>(i));
+        }
+    }
+
+    std::destroy_n(to, N);
+    alloc.deallocate(from, N);
+    alloc.deallocate(to, N);
+}
+
+TEST(Relocate, VectorGrowth) {
+    std::vector<Result<std::string, Code>> rs;
+    for (int i = 0; i < 1000; ++i) {
+        rs.emplace_back(std::string(i % 64, 'x'));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(rs[i]->size(), static_cast<size_t>(i % 64));
+    }
+}
+
+}  // namespace result
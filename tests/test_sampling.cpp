@@ -0,0 +1,197 @@
+#include "result/combine/and_then.h"
+#include "result/combine/map.h"
+#include "result/coro.h"
+#include "result/error/inline_message.h"
+#include "result/pipe.h"  // IWYU pragma: keep
+#include "result/result.h"
+#include "result/sampling.h"
+#include "result/try.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace result {
+
+struct SampledError {
+    std::string_view message() const {
+        return "disk is full";
+    }
+};
+
+enum class SampledCode { First = 1, Second = 2 };
+
+struct SampledOpaque {};
+
+namespace {
+
+Result<int, SampledCode> failing() {
+    return makeError(SampledCode::First);
+}
+
+Result<int, SampledCode> tryFailing() {
+    int x = RESULT_TRY(failing());
+    return x + 1;
+}
+
+Result<int, SampledCode, ExceptionError> coroutine(bool fail) {
+    if (fail) {
+        co_return co_await tryFailing();
+    }
+    throw std::runtime_error("thrown");
+}
+
+std::vector<std::string> drainMessages() {
+    std::vector<std::string> messages;
+    ErrorSampler::global().drain(
+        [&](const ErrorSample& s) { messages.emplace_back(s.message.message()); });
+    return messages;
+}
+
+class Sampling : public testing::Test {
+ protected:
+    void SetUp() override {
+        drainMessages();
+    }
+
+    void TearDown() override {
+        ErrorSampler::global().disable();
+        drainMessages();
+    }
+};
+
+}  // namespace
+
+TEST(TypeName, Names) {
+    static_assert(detail::TypeName<int> == "int");
+    EXPECT_EQ(detail::TypeName<SampledError>, "result::SampledError");
+    EXPECT_EQ(detail::TypeName<InlineMessage<8>>, "result::InlineMessage<8>");
+}
+
+TEST(RenderError, Alternatives) {
+    auto render = []<typename E>(const E& error) {
+        detail::ErrorRendering out;
+        detail::renderError<E>(&error, out);
+        return std::string(out.message());
+    };
+
+    EXPECT_EQ(render(SampledError{}), "disk is full");
+    EXPECT_EQ(render(std::string("not found")), "not found");
+    EXPECT_EQ(render(42), "42");
+    EXPECT_EQ(render(true), "true");
+    EXPECT_EQ(render(SampledCode::Second), "2");
+    EXPECT_EQ(render(SampledOpaque{}), "result::SampledOpaque");
+}
+
+TEST_F(Sampling, DisabledByDefault) {
+    EXPECT_FALSE(ErrorSampler::global().enabled());
+    [[maybe_unused]] auto r = makeError(SampledError{});
+    EXPECT_TRUE(drainMessages().empty());
+}
+
+TEST_F(Sampling, Captures) {
+    ErrorSampler::global().enable();
+
+    [[maybe_unused]] auto a = makeError(SampledError{});
+    [[maybe_unused]] auto b = makeError<std::string>("timeout");
+    [[maybe_unused]] Result<int, SampledCode> c = 1;
+
+    std::vector<ErrorSample> samples;
+    EXPECT_EQ(ErrorSampler::global().drain([&](const ErrorSample& s) { samples.push_back(s); }),
+              2U);
+    ASSERT_EQ(samples.size(), 2U);
+    EXPECT_EQ(samples[0].type, "result::SampledError");
+    EXPECT_EQ(samples[0].message.message(), "disk is full");
+    EXPECT_EQ(samples[1].message.message(), "timeout");
+
+    EXPECT_TRUE(drainMessages().empty());
+}
+
+TEST_F(Sampling, Rate) {
+    ErrorSampler::global().enable(10);
+    for (int i = 0; i < 100; ++i) {
+        [[maybe_unused]] auto r = makeError(i);
+    }
+
+    auto messages = drainMessages();
+    ASSERT_EQ(messages.size(), 10U);
+    for (size_t i = 1; i < messages.size(); ++i) {
+        EXPECT_EQ(std::stoi(messages[i]) - std::stoi(messages[i - 1]), 10);
+    }
+}
+
+TEST_F(Sampling, DropsWhenFull) {
+    ErrorSampler::global().enable();
+    const uint64_t dropped = ErrorSampler::global().dropped();
+
+    for (size_t i = 0; i < ErrorSampler::RingCapacity + 10; ++i) {
+        [[maybe_unused]] auto r = makeError(SampledCode::First);
+    }
+
+    EXPECT_EQ(drainMessages().size(), ErrorSampler::RingCapacity);
+    EXPECT_EQ(ErrorSampler::global().dropped() - dropped, 10U);
+}
+
+TEST_F(Sampling, OncePerFailure) {
+    ErrorSampler::global().enable();
+
+    auto half = [](int x) -> Result<int, SampledCode> {
+        if (x % 2 != 0) {
+            return makeError(SampledCode::Second);
+        }
+        return x / 2;
+    };
+
+    // Failing at the start, then in the middle of the pipeline
+    for (Result<int, SampledCode> input : {Result<int, SampledCode>(makeError(SampledCode::First)),
+                                          Result<int, SampledCode>(6)}) {
+        auto r = std::move(input) | map([](int x) { return x + 1; }) | andThen(half) |
+                 map([](int x) { return x * 2; }) | andThen(half);
+        EXPECT_FALSE(r.hasValue());
+    }
+
+    const auto messages = drainMessages();
+    ASSERT_EQ(messages.size(), 2U);
+    EXPECT_EQ(messages[0], "1");
+    EXPECT_EQ(messages[1], "2");
+}
+
+// Seen where they are made, by makeError() or not, and not where they are passed on
+TEST_F(Sampling, OncePerError) {
+    ErrorSampler::global().enable();
+
+    EXPECT_TRUE(coroutine(true).hasError<SampledCode>());
+    EXPECT_TRUE(coroutine(false).hasError<ExceptionError>());
+
+    EXPECT_EQ(drainMessages(), (std::vector<std::string>{"1", "thrown"}));
+}
+
+TEST_F(Sampling, Threads) {
+    constexpr int Threads = 4;
+    constexpr int PerThread = 100;
+
+    ErrorSampler::global().enable();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < PerThread; ++i) {
+                [[maybe_unused]] auto r = makeError(SampledError{});
+            }
+        });
+    }
+
+    size_t drained = 0;
+    for (auto& thread : threads) {
+        drained += drainMessages().size();
+        thread.join();
+    }
+    drained += drainMessages().size();
+
+    EXPECT_EQ(drained, size_t{Threads * PerThread});
+}
+
+}  // namespace result
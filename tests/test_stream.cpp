@@ -0,0 +1,149 @@
+#include "result/combine/and_then.h"
+#include "result/combine/map.h"
+#include "result/combine/map_err.h"
+#include "result/detail/overloaded.h"
+#include "result/stream.h"
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace result {
+
+namespace {
+
+struct ParseError {
+    int line = 0;
+};
+
+struct IoError {};
+
+using Row = Result<int, ParseError, IoError>;
+
+static_assert(std::ranges::input_range<Generator<Row>>);
+
+Result<int, IoError> readLine(int i, int fail_at) {
+    if (i == fail_at) {
+        return makeError(IoError{});
+    }
+    return i;
+}
+
+// Lines divisible by 3 do not parse, reading line `fail_at` fails
+Generator<Row> rows(int count, int fail_at = -1) {
+    for (int i = 1; i <= count; ++i) {
+        int line = co_await readLine(i, fail_at);
+        if (line % 3 == 0) {
+            co_yield makeError(ParseError{line});
+        } else {
+            co_yield line;
+        }
+    }
+}
+
+template <typename R>
+std::vector<std::string> render(Generator<R> g) {
+    std::vector<std::string> out;
+    for (auto& r : g) {
+        out.push_back(r.taggedVisit(detail::Overloaded{
+            [](val_tag_t, const auto& value) { return std::to_string(value); },
+            [](const ParseError&) { return std::string("parse"); },
+            [](const IoError&) { return std::string("io"); },
+            [](const auto&) { return std::string("error"); },
+        }));
+    }
+    return out;
+}
+
+using Strings = std::vector<std::string>;
+
+}  // namespace
+
+TEST(Stream, Yield) {
+    EXPECT_EQ(render(rows(5)), (Strings{"1", "2", "parse", "4", "5"}));
+}
+
+TEST(Stream, Lazy) {
+    int produced = 0;
+    auto coro = [&produced] -> Generator<Row> {
+        for (int i = 0;; ++i) {
+            ++produced;
+            co_yield i;
+        }
+    };
+
+    auto g = coro();
+    EXPECT_EQ(produced, 0);
+
+    for (auto& r : g) {
+        if (*r == 2) {
+            break;
+        }
+    }
+    EXPECT_EQ(produced, 3);
+}
+
+TEST(Stream, AwaitErrorEndsStream) {
+    EXPECT_EQ(render(rows(5, 2)), (Strings{"1", "io"}));
+}
+
+TEST(Stream, ExceptionEndsStream) {
+    auto numbers = [](int throw_at) -> Generator<Result<int, IoError, ExceptionError>> {
+        for (int i = 1;; ++i) {
+            if (i == throw_at) {
+                throw std::runtime_error("boom");
+            }
+            co_yield i;
+        }
+    };
+
+    EXPECT_EQ(render(numbers(3)), (Strings{"1", "2", "error"}));
+}
+
+TEST(Stream, StopOnError) {
+    EXPECT_EQ(render(rows(5) | stopOnError()), (Strings{"1", "2", "parse"}));
+}
+
+TEST(Stream, Map) {
+    auto g = rows(4) | map([](int x) { return x * 10; });
+    EXPECT_EQ(render(std::move(g)), (Strings{"10", "20", "parse", "40"}));
+}
+
+TEST(Stream, AndThen) {
+    auto g = rows(4) | andThen([](int x) -> Result<int, std::string> {
+                 if (x == 4) {
+                     return makeError(std::string("four"));
+                 }
+                 return x;
+             });
+    EXPECT_EQ(render(std::move(g)), (Strings{"1", "2", "parse", "error"}));
+}
+
+TEST(Stream, MapErr) {
+    auto g = rows(4, 4) | mapErr(detail::Overloaded{
+                              [](ParseError e) { return e.line; },
+                              [](IoError) { return std::string("io"); },
+                          });
+
+    static_assert(std::is_same_v<decltype(g), Generator<Result<int, int, std::string>>>);
+    EXPECT_EQ(render(std::move(g)), (Strings{"1", "2", "error", "error"}));
+}
+
+TEST(Stream, Long) {
+    auto naturals = [] -> Generator<Result<int64_t, IoError>> {
+        for (int64_t i = 0; i < 1'000'000; ++i) {
+            co_yield i;
+        }
+    };
+
+    int64_t sum = 0;
+    for (auto& r : naturals() | map([](int64_t x) { return 2 * x; }) | stopOnError()) {
+        sum += *r;
+    }
+    EXPECT_EQ(sum, 999'999'000'000);
+}
+
+}  // namespace result
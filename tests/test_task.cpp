@@ -0,0 +1,147 @@
+#include "result/task.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+
+namespace result {
+
+template <typename T>
+using Res = Result<T, std::string>;
+
+Task<Res<int>> just(int x) {
+    co_return x;
+}
+
+Task<Res<int>> faulty(std::string err) {
+    co_return makeError(std::move(err));
+}
+
+TEST(Task, Lazy) {
+    bool started = false;
+    auto coro = [&] -> Task<Res<int>> {
+        started = true;
+        co_return 1;
+    };
+
+    auto task = coro();
+
+    EXPECT_FALSE(started);
+    EXPECT_EQ(*syncWait(std::move(task)), 1);
+    EXPECT_TRUE(started);
+}
+
+TEST(Task, AwaitTask) {
+    auto r = syncWait([] -> Task<Res<int>> {
+        int x = co_await just(1);
+        int y = co_await just(2);
+        co_return x + y;
+    }());
+
+    EXPECT_EQ(*r, 3);
+}
+
+TEST(Task, AwaitTaskError) {
+    bool resumed = false;
+    auto r = syncWait([&] -> Task<Result<int, char, std::string>> {
+        int x = co_await just(1);
+        int y = co_await faulty("hello");
+        resumed = true;
+        co_return x + y;
+    }());
+
+    EXPECT_FALSE(resumed);
+    EXPECT_EQ(r.error<std::string>(), "hello");
+}
+
+TEST(Task, AwaitResult) {
+    auto r = syncWait([] -> Task<Res<int>> {
+        Res<int> ok = 2;
+        int x = co_await ok;
+        int y = co_await Res<int>(makeError<std::string>("hello"));
+        co_return x + y;
+    }());
+
+    EXPECT_EQ(r.error<std::string>(), "hello");
+}
+
+// The inner task fails on a co_await of a Result rather than on co_return
+TEST(Task, AwaitNestedResultError) {
+    bool resumed = false;
+    auto inner = [] -> Task<Res<int>> {
+        co_await Res<int>(makeError<std::string>("inner"));
+        co_return 1;
+    };
+
+    auto r = syncWait([&] -> Task<Result<int, char, std::string>> {
+        int x = co_await inner();
+        resumed = true;
+        co_return x;
+    }());
+
+    EXPECT_FALSE(resumed);
+    EXPECT_EQ(r.error<std::string>(), "inner");
+}
+
+TEST(Task, ExceptionsBecomeErrors) {
+    bool resumed = false;
+    auto inner = [](bool fail) -> Task<Result<int, ExceptionError>> {
+        if (fail) {
+            throw std::runtime_error("boom");
+        }
+        co_return 1;
+    };
+
+    auto r = syncWait([&] -> Task<Result<int, std::string, ExceptionError>> {
+        int x = co_await inner(false);
+        int y = co_await inner(true);
+        resumed = true;
+        co_return x + y;
+    }());
+
+    EXPECT_FALSE(resumed);
+    ASSERT_TRUE(r.hasError<ExceptionError>());
+    EXPECT_EQ(r.error<ExceptionError>().message(), "boom");
+}
+
+TEST(Task, AwaitRawResult) {
+    auto r = syncWait([] -> Task<Res<int>> {
+        Res<int> e = co_await faulty("hello").result();
+        EXPECT_EQ(e.error<std::string>(), "hello");
+        co_return 1;
+    }());
+
+    EXPECT_EQ(*r, 1);
+}
+
+TEST(Task, SymmetricTransfer) {
+    auto r = syncWait([] -> Task<Res<int>> {
+        int sum = 0;
+        for (int i = 0; i < 1'000'000; ++i) {
+            sum += co_await just(1);
+        }
+        co_return sum;
+    }());
+
+    EXPECT_EQ(*r, 1'000'000);
+}
+
+TEST(Task, ThreadPool) {
+    ThreadPool pool(4);
+    auto caller = std::this_thread::get_id();
+
+    auto r = syncWait(pool, [&] -> Task<Res<int>> {
+        EXPECT_NE(std::this_thread::get_id(), caller);
+        int sum = 0;
+        for (int i = 0; i < 1000; ++i) {
+            co_await schedule(pool);
+            sum += co_await just(i);
+        }
+        co_return sum;
+    }());
+
+    EXPECT_EQ(*r, 999 * 1000 / 2);
+}
+
+}  // namespace result
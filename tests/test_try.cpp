@@ -0,0 +1,85 @@
+#include "result/try.h"
+
+#include "./remember_op.h"
+
+#include <gtest/gtest.h>
+
+namespace result {
+
+Result<int, std::string> parse(int x) {
+    if (x < 0) {
+        return makeError<std::string>("negative");
+    }
+    return x;
+}
+
+Result<int, std::string, float> twice(int x) {
+    int v = RESULT_TRY(parse(x));
+    return v * 2;
+}
+
+Result<std::string, char, std::string> render(int x) {
+    RESULT_TRY_ASSIGN(int v, parse(x));
+    RESULT_TRY_ASSIGN(auto&& u, twice(v));
+    return std::to_string(u);
+}
+
+TEST(Try, Value) {
+    auto r = twice(2);
+    EXPECT_EQ(*r, 4);
+}
+
+TEST(Try, Error) {
+    auto r = twice(-1);
+    EXPECT_TRUE(r.hasError<std::string>());
+    EXPECT_EQ(r.error<std::string>(), "negative");
+}
+
+TEST(Try, AssignValue) {
+    auto r = render(2);
+    EXPECT_EQ(*r, "4");
+}
+
+TEST(Try, AssignError) {
+    auto r = render(-1);
+    EXPECT_EQ(r.error<std::string>(), "negative");
+}
+
+TEST(Try, Lvalue) {
+    Result<int, std::string> e = makeError<std::string>("error");
+
+    auto r = [&] -> Result<int, std::string> {
+        RESULT_TRY_ASSIGN(int& v, e);
+        return v;
+    }();
+
+    EXPECT_EQ(r.error<std::string>(), "error");
+    EXPECT_EQ(e.error<std::string>(), "error");
+}
+
+using OpVal = test::RememberLastOp<0>;
+using OpErr = test::RememberLastOp<1>;
+
+Result<OpVal, OpErr> opError() {
+    return makeError<OpErr>();
+}
+
+Result<int, char, OpErr> opPropagate() {
+    [[maybe_unused]] OpVal v = RESULT_TRY(opError());
+    return 1;
+}
+
+TEST(TryOps, ErrorIsMovedOnce) {
+    test::OpCollector collector;
+    auto r = opPropagate();
+
+    EXPECT_TRUE(r.hasError<OpErr>());
+    EXPECT_TRUE(collector.equal(
+        test::Op(test::Create, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1),
+        test::Op(test::CONSTRUCT_MOVE, 1),
+        test::Op(test::Destroy, 1)));
+}
+
+}  // namespace result
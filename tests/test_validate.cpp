@@ -0,0 +1,125 @@
+#include "result/detail/overloaded.h"
+#include "result/validate.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace result {
+
+namespace {
+
+struct Empty {};
+
+struct TooLong {
+    size_t length = 0;
+};
+
+struct OutOfRange {
+    int value = 0;
+};
+
+Result<std::string, Empty, TooLong> checkName(std::string name) {
+    if (name.empty()) {
+        return makeError(Empty{});
+    }
+    if (name.size() > 8) {
+        return makeError(TooLong{name.size()});
+    }
+    return name;
+}
+
+Result<int, OutOfRange> checkAge(int age) {
+    if (age < 0 || age > 150) {
+        return makeError(OutOfRange{age});
+    }
+    return age;
+}
+
+using Errors = ValidationErrors<8, Empty, TooLong, OutOfRange>;
+
+}  // namespace
+
+TEST(Validate, AllValid) {
+    auto r = validateAll(checkName("alice"), checkAge(30));
+    static_assert(std::is_same_v<decltype(r), Result<std::tuple<std::string, int>, Errors>>);
+
+    ASSERT_TRUE(r.hasValue());
+    EXPECT_EQ(*r, std::make_tuple(std::string("alice"), 30));
+}
+
+TEST(Validate, CollectsEveryError) {
+    auto r = validateAll(checkName("a very long name"), checkAge(-1), checkAge(200));
+    ASSERT_TRUE(r.hasAnyError());
+
+    const auto& errors = r.error<ValidationErrors<8, Empty, TooLong, OutOfRange>>();
+    ASSERT_EQ(errors.size(), 3U);
+    EXPECT_EQ(errors.overflow(), 0U);
+    EXPECT_EQ(errors[0].error<TooLong>().length, 16U);
+    EXPECT_EQ(errors[1].error<OutOfRange>().value, -1);
+    EXPECT_EQ(errors[2].error<OutOfRange>().value, 200);
+}
+
+TEST(Validate, Lvalues) {
+    auto name = checkName("");
+    auto age = checkAge(1);
+
+    auto r = validateAll(name, age);
+    ASSERT_TRUE(r.hasAnyError());
+    EXPECT_TRUE(r.error<Errors>()[0].hasError<Empty>());
+    EXPECT_EQ(*age, 1);
+}
+
+TEST(Validate, Overflow) {
+    auto r = validateAll<2>(checkAge(-1), checkAge(-2), checkAge(-3), checkAge(4), checkAge(-5));
+
+    const auto& errors = r.error<ValidationErrors<2, OutOfRange>>();
+    EXPECT_EQ(errors.size(), 2U);
+    EXPECT_EQ(errors.overflow(), 2U);
+    EXPECT_EQ(errors.total(), 4U);
+    EXPECT_EQ(errors[1].error<OutOfRange>().value, -2);
+}
+
+TEST(Validate, ErrorsAreCopyable) {
+    auto r = validateAll(checkName(""), checkAge(-1));
+    auto copy = r;
+    auto moved = std::move(r);
+
+    EXPECT_EQ(copy.error<Errors>().size(), 2U);
+    EXPECT_EQ(moved.error<Errors>().size(), 2U);
+    EXPECT_TRUE(moved.error<Errors>()[0].hasError<Empty>());
+}
+
+TEST(Validate, ErrorsAreAssignable) {
+    Errors two = validateAll(checkName(""), checkAge(-1)).error<Errors>();
+    Errors one = validateAll(checkName("bob"), checkAge(-1)).error<Errors>();
+
+    Errors errors = two;
+    errors = one;
+    ASSERT_EQ(errors.size(), 1U);
+    EXPECT_EQ(errors[0].error<OutOfRange>().value, -1);
+
+    errors = std::move(two);
+    ASSERT_EQ(errors.size(), 2U);
+    EXPECT_TRUE(errors[0].hasError<Empty>());
+}
+
+TEST(Validate, VisitError) {
+    auto r = validateAll(checkName("a very long name"), checkAge(-1));
+
+    std::vector<int> seen;
+    for (const auto& error : r.error<Errors>()) {
+        seen.push_back(error.visit(detail::Overloaded{
+            [](const TooLong& e) { return static_cast<int>(e.length); },
+            [](const OutOfRange& e) { return e.value; },
+            [](const Empty&) { return 0; },
+        }));
+    }
+    EXPECT_EQ(seen, (std::vector<int>{16, -1}));
+}
+
+}  // namespace result
@@ -0,0 +1,184 @@
+#include "result/result.h"
+#include "result/wire.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace result {
+
+namespace {
+
+struct Code {
+    int32_t value = 0;
+};
+
+// Never encodable, like a string longer than its length prefix can tell
+struct Oversize {};
+
+}  // namespace
+
+template <>
+struct wire::RawBytes<Code> : std::true_type {};
+
+template <>
+struct wire::Codec<Oversize> {
+    using View = Oversize;
+
+    static std::optional<size_t> size(const Oversize&) noexcept {
+        return std::nullopt;
+    }
+
+    static std::byte* encode(const Oversize&, std::byte* out) noexcept {
+        return out;
+    }
+
+    static std::optional<View> decode(std::span<const std::byte>&) noexcept {
+        return std::nullopt;
+    }
+};
+
+namespace {
+
+using R = Result<int64_t, Code>;
+using S = Result<std::string, Code>;
+
+static_assert(std::is_same_v<wire::View<R>, Result<wire::Ref<int64_t>, wire::Ref<Code>>>);
+static_assert(std::is_same_v<wire::View<S>, Result<std::string_view, wire::Ref<Code>>>);
+
+template <typename T>
+std::vector<std::byte> encodeAll(std::span<const T> rs) {
+    std::vector<std::byte> bytes(wire::encodedSize(rs).value());
+    EXPECT_EQ(wire::encodeBatch(rs, bytes.data()), bytes.data() + bytes.size());
+    return bytes;
+}
+
+}  // namespace
+
+TEST(Wire, Value) {
+    const R r = 42;
+    EXPECT_EQ(wire::encodedSize(r).value(), 1 + sizeof(int64_t));
+
+    std::vector<std::byte> bytes(wire::encodedSize(r).value());
+    EXPECT_EQ(wire::encode(r, bytes.data()), bytes.data() + bytes.size());
+
+    std::span<const std::byte> in = bytes;
+    auto view = wire::decode<R>(in);
+    ASSERT_TRUE(view.hasValue());
+    EXPECT_TRUE(in.empty());
+    ASSERT_TRUE(view.value().hasValue());
+    EXPECT_EQ(*view.value().value(), 42);
+    EXPECT_EQ(view.value().value().data(), bytes.data() + 1);
+}
+
+TEST(Wire, Error) {
+    const R r = makeError(Code{7});
+    EXPECT_EQ(wire::encodedSize(r).value(), 1 + sizeof(Code));
+
+    std::vector<std::byte> bytes(wire::encodedSize(r).value());
+    wire::encode(r, bytes.data());
+
+    std::span<const std::byte> in = bytes;
+    auto view = wire::decode<R>(in);
+    ASSERT_TRUE(view.hasValue());
+    ASSERT_TRUE(view.value().hasError<wire::Ref<Code>>());
+    EXPECT_EQ((*view.value().error<wire::Ref<Code>>()).value, 7);
+}
+
+TEST(Wire, ByteOrder) {
+    const R r = int64_t{0x0102030405060708};
+    std::vector<std::byte> bytes(wire::encodedSize(r).value());
+    wire::encode(r, bytes.data());
+
+    // Little-endian on any host
+    EXPECT_EQ(bytes[1], std::byte{0x08});
+    EXPECT_EQ(bytes[8], std::byte{0x01});
+}
+
+TEST(Wire, TooLarge) {
+    using O = Result<int64_t, Oversize>;
+    const O rs[] = {1, makeError(Oversize{})};
+
+    EXPECT_TRUE(wire::encodedSize(rs[0]).hasValue());
+    EXPECT_EQ(wire::encodedSize(rs[1]).error<wire::EncodeError>().reason,
+              wire::EncodeError::TooLarge);
+
+    auto size = wire::encodedSize(std::span<const O>(rs));
+    ASSERT_TRUE(size.hasAnyError());
+    EXPECT_EQ(size.error<wire::EncodeError>().index, 1U);
+}
+
+TEST(Wire, String) {
+    const S rs[] = {std::string("hello"), makeError(Code{1}), std::string()};
+    auto bytes = encodeAll<S>(rs);
+
+    std::vector<std::string_view> values;
+    auto count = wire::decodeBatch<S>(bytes, [&](wire::View<S> view) {
+        values.push_back(view.hasValue() ? view.value() : "error");
+    });
+    ASSERT_TRUE(count.hasValue());
+    EXPECT_EQ(count.value(), 3U);
+    EXPECT_EQ(values, (std::vector<std::string_view>{"hello", "error", ""}));
+
+    // Views refer to the input buffer
+    EXPECT_GE(values[0].data(), reinterpret_cast<const char*>(bytes.data()));  // NOLINT
+    EXPECT_LT(values[0].data(), reinterpret_cast<const char*>(bytes.data() + bytes.size()));  // NOLINT
+}
+
+TEST(Wire, Batch) {
+    std::vector<R> rs;
+    for (int i = 0; i < 100; ++i) {
+        rs.push_back(i % 3 == 0 ? R(makeError(Code{i})) : R(i));
+    }
+    auto bytes = encodeAll<R>(rs);
+
+    size_t i = 0;
+    auto count = wire::decodeBatch<R>(bytes, [&](wire::View<R> view) {
+        ASSERT_EQ(view.hasValue(), rs[i].hasValue());
+        if (view.hasValue()) {
+            EXPECT_EQ(*view.value(), rs[i].value());
+        } else {
+            EXPECT_EQ((*view.error<wire::Ref<Code>>()).value, rs[i].error<Code>().value);
+        }
+        ++i;
+    });
+    ASSERT_TRUE(count.hasValue());
+    EXPECT_EQ(count.value(), rs.size());
+}
+
+TEST(Wire, Truncated) {
+    const R rs[] = {1, 2};
+    auto bytes = encodeAll<R>(rs);
+    bytes.pop_back();
+
+    auto count = wire::decodeBatch<R>(bytes, [](wire::View<R>) {});
+    ASSERT_TRUE(count.hasAnyError());
+    EXPECT_EQ(count.error<wire::DecodeError>().reason, wire::DecodeError::Truncated);
+    EXPECT_EQ(count.error<wire::DecodeError>().offset, 1 + sizeof(int64_t));
+
+    std::span<const std::byte> in = std::span(bytes).subspan(0, 0);
+    EXPECT_EQ(wire::decode<R>(in).error<wire::DecodeError>().reason,
+              wire::DecodeError::Truncated);
+}
+
+TEST(Wire, BadIndex) {
+    const R r = 1;
+    std::vector<std::byte> bytes(wire::encodedSize(r).value());
+    wire::encode(r, bytes.data());
+    bytes[0] = std::byte{2};
+
+    std::span<const std::byte> in = bytes;
+    auto view = wire::decode<R>(in);
+    ASSERT_TRUE(view.hasAnyError());
+    EXPECT_EQ(view.error<wire::DecodeError>().reason, wire::DecodeError::BadIndex);
+    EXPECT_EQ(in.size(), bytes.size());
+}
+
+}  // namespace result